@@ -0,0 +1,260 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <plugindata.h>
+
+#include "core_bench.h"
+#include "corpus.h"
+#include "harness.h"
+#include "jump_to_a_word.h"
+#include "multicursor_sweep.h"
+#include "replace_sweep.h"
+#include "replay.h"
+#include "scaling.h"
+#include "sci_stub.h"
+#include "startup.h"
+
+static gint lines = 50000;
+static gint words_per_line = 8;
+static gint line_length = 0;
+static gint utf8_percent = 0;
+static gint screen_lines = 60;
+static gint iterations = 50;
+static gint seed = 1;
+static gboolean whole_document = FALSE;
+static gboolean label_overlay = FALSE;
+static gchar *substring_query = "in";
+static gchar *char_query = "e";
+static gboolean verbose = FALSE;
+static gchar *replay_path = NULL;
+static gboolean scaling = FALSE;
+static gchar *scaling_sizes = "10k,50k,200k,1m,2m";
+static gchar *json_path = "bench-scaling.json";
+static gboolean replace_whole_document = FALSE;
+static gboolean replace_sweep = FALSE;
+static gchar *sweep_occurrences = "10,100,1k,10k,100k";
+static gchar *sweep_spacings = "16,256";
+static gchar *sweep_lengths = "1,8,32";
+static gboolean multicursor_sweep = FALSE;
+static gchar *sweep_cursors = "10,100,1k,10k,100k";
+static gboolean core = FALSE;
+static gboolean startup = FALSE;
+static gint startup_budget = 10000;
+
+static GOptionEntry entries[] = {
+    {"lines", 'l', 0, G_OPTION_ARG_INT, &lines, "Lines in the synthetic document", "N"},
+    {"words", 'w', 0, G_OPTION_ARG_INT, &words_per_line, "Average words per line", "N"},
+    {"line-length", 0, 0, G_OPTION_ARG_INT, &line_length, "Pad lines with a comment up to N bytes", "N"},
+    {"utf8", 0, 0, G_OPTION_ARG_INT, &utf8_percent, "Percentage of non-ASCII identifiers", "PERCENT"},
+    {"screen", 's', 0, G_OPTION_ARG_INT, &screen_lines, "Lines on screen", "N"},
+    {"iterations", 'i', 0, G_OPTION_ARG_INT, &iterations, "Timed activations per mode", "N"},
+    {"seed", 0, 0, G_OPTION_ARG_INT, &seed, "Seed for the corpus generator", "N"},
+    {"whole-document", 'd', 0, G_OPTION_ARG_NONE, &whole_document, "Search the whole document", NULL},
+    {"overlay", 0, 0, G_OPTION_ARG_NONE, &label_overlay, "Draw shortcuts over the text instead of writing them", NULL},
+    {"substring", 0, 0, G_OPTION_ARG_STRING, &substring_query, "Query for substring search", "TEXT"},
+    {"char", 0, 0, G_OPTION_ARG_STRING, &char_query, "Query for character jump", "C"},
+    {"verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print status bar messages", NULL},
+    {"replay", 'r', 0, G_OPTION_ARG_FILENAME, &replay_path, "Replay a recorded interaction", "FILE"},
+    {"scaling", 0, 0, G_OPTION_ARG_NONE, &scaling, "Run the whole-document scaling suite", NULL},
+    {"sizes", 0, 0, G_OPTION_ARG_STRING, &scaling_sizes, "Document sizes in lines for --scaling", "N,N,..."},
+    {"json", 'j', 0, G_OPTION_ARG_FILENAME, &json_path, "Report written by --scaling", "FILE"},
+    {"replace-whole-document", 0, 0, G_OPTION_ARG_NONE, &replace_whole_document,
+     "Replace across the whole document in --scaling", NULL},
+    {"replace-sweep", 0, 0, G_OPTION_ARG_NONE, &replace_sweep, "Time live replacement one key at a time", NULL},
+    {"occurrences", 0, 0, G_OPTION_ARG_STRING, &sweep_occurrences, "Matches for --replace-sweep", "N,N,..."},
+    {"spacing", 0, 0, G_OPTION_ARG_STRING, &sweep_spacings, "Bytes between matches for --replace-sweep", "N,N,..."},
+    {"replace-length", 0, 0, G_OPTION_ARG_STRING, &sweep_lengths, "Keys typed for --replace-sweep", "N,N,..."},
+    {"multicursor", 0, 0, G_OPTION_ARG_NONE, &multicursor_sweep, "Time adding and acting on many cursors", NULL},
+    {"cursors", 0, 0, G_OPTION_ARG_STRING, &sweep_cursors, "Cursor counts for --multicursor", "N,N,..."},
+    {"core", 0, 0, G_OPTION_ARG_NONE, &core, "Time the core library on the corpus without an editor", NULL},
+    {"startup", 0, 0, G_OPTION_ARG_NONE, &startup, "Time loading and initializing the plugin (needs a display)", NULL},
+    {"startup-budget", 0, 0, G_OPTION_ARG_INT, &startup_budget, "Fail --startup above this median, 0 to disable",
+     "US"},
+    {NULL}};
+
+static void bench_print_result(const BenchMode *mode, const BenchResult *result) {
+    printf("%-34s %8d %10" G_GUINT64_FORMAT " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT
+           " %10" G_GINT64_FORMAT "\n",
+           mode->name, result->targets, result->messages, result->min, result->median, result->mean, result->max);
+}
+
+int main(int argc, char **argv) {
+    GError *error = NULL;
+    GOptionContext *context = g_option_context_new("- time Jump to a Word activations against a headless editor");
+
+    g_option_context_add_main_entries(context, entries, NULL);
+
+    if (!g_option_context_parse(context, &argc, &argv, &error)) {
+        g_printerr("%s\n", error->message);
+        g_error_free(error);
+        g_option_context_free(context);
+        return 1;
+    }
+
+    g_option_context_free(context);
+
+    if (lines < 1 || screen_lines < 1 || iterations < 1 || strlen(char_query) == 0 || strlen(substring_query) == 0 ||
+        utf8_percent < 0 || utf8_percent > 100) {
+        g_printerr("Invalid arguments\n");
+        return 1;
+    }
+
+    if (replay_path) {
+        ScintillaObject *sci = sci_stub_new("");
+        ShortcutJump *sj;
+        gboolean replayed;
+
+        sci_stub_set_verbose(verbose);
+        sci_stub_set_current(sci);
+        sj = bench_new_sj(whole_document);
+        sj->config_settings->label_overlay = label_overlay;
+
+        replayed = replay_run(sj, sci, replay_path, iterations, &error);
+
+        if (!replayed) {
+            g_printerr("%s: %s\n", replay_path, error->message);
+            g_error_free(error);
+        }
+
+        bench_free_sj(sj);
+        sci_stub_free(sci);
+
+        return replayed ? 0 : 1;
+    }
+
+    CorpusOptions corpus = {
+        .lines = lines,
+        .words_per_line = words_per_line,
+        .line_length = line_length,
+        .utf8_percent = utf8_percent,
+        .seed = seed,
+    };
+    BenchContext bench = {
+        .substring_query = substring_query,
+        .char_query = g_utf8_get_char(char_query),
+        .first_line = lines / 2,
+        .screen_lines = screen_lines,
+        .iterations = iterations,
+    };
+
+    sci_stub_set_verbose(verbose);
+
+    if (startup) {
+        StartupOptions options = {
+            .iterations = iterations,
+            .budget = startup_budget,
+        };
+
+        if (!startup_run(&options, &error)) {
+            g_printerr("%s\n", error->message);
+            g_error_free(error);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    if (multicursor_sweep) {
+        MulticursorSweepOptions options = {
+            .cursors = sweep_cursors,
+            .screen_lines = screen_lines,
+        };
+
+        if (!multicursor_sweep_run(&options, &error)) {
+            g_printerr("%s\n", error->message);
+            g_error_free(error);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    if (replace_sweep) {
+        ReplaceSweepOptions options = {
+            .occurrences = sweep_occurrences,
+            .spacings = sweep_spacings,
+            .lengths = sweep_lengths,
+            .screen_lines = screen_lines,
+        };
+
+        if (!replace_sweep_run(&options, &error)) {
+            g_printerr("%s\n", error->message);
+            g_error_free(error);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    if (scaling) {
+        ScalingOptions options = {
+            .sizes = scaling_sizes,
+            .json_path = json_path,
+            .corpus = corpus,
+            .context = bench,
+            .replace_whole_document = replace_whole_document,
+        };
+
+        if (!scaling_run(&options, &error)) {
+            g_printerr("%s\n", error->message);
+            g_error_free(error);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    gchar *text = corpus_generate(&corpus);
+
+    if (core) {
+        printf("%d lines, %zu bytes, %d iterations\n\n", lines, strlen(text), iterations);
+        core_bench_run(text, substring_query, iterations);
+        g_free(text);
+        return 0;
+    }
+
+    ScintillaObject *sci = sci_stub_new(text);
+    ShortcutJump *sj;
+
+    sci_stub_set_current(sci);
+    sj = bench_new_sj(whole_document);
+    sj->config_settings->label_overlay = label_overlay;
+    bench.sci = sci;
+    bench.text = text;
+
+    printf("%d lines, %d bytes, %d lines on screen, %d iterations%s%s\n\n", lines, sci_stub_get_length(sci),
+           screen_lines, iterations, whole_document ? ", whole document" : "", label_overlay ? ", label overlay" : "");
+    printf("%-34s %8s %10s %10s %10s %10s %10s\n", "activation", "targets", "messages", "min us", "median us",
+           "mean us", "max us");
+
+    for (gint i = 0; i < bench_modes_count; i++) {
+        BenchResult result;
+
+        bench_measure(sj, &bench, &bench_modes[i], &result);
+        bench_print_result(&bench_modes[i], &result);
+    }
+
+    bench_free_sj(sj);
+    sci_stub_free(sci);
+    g_free(text);
+
+    return 0;
+}
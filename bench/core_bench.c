@@ -0,0 +1,181 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <plugindata.h>
+
+#include "core/label.h"
+#include "core/line_index.h"
+#include "core/match.h"
+#include "core/replace_cache.h"
+#include "core/tokenizer.h"
+#include "core/utf8_scan.h"
+#include "core_bench.h"
+#include "harness.h"
+
+/*
+ * Times the core library on the corpus as a plain buffer, with no editor in the loop, so the numbers (and a profile
+ * of this binary) show the cost of the algorithms alone.
+ */
+
+typedef struct {
+    const gchar *text;
+    gint length;
+    const gchar *query;
+    gint query_length;
+    WordChars word_chars;
+    MatchOptions options;
+    GArray *spans;
+    GArray *positions;
+    GArray *line_starts;
+} CoreBench;
+
+typedef struct {
+    const gchar *name;
+    gint (*run)(CoreBench *bench);
+} CoreBenchStep;
+
+static gint core_bench_tokenize(CoreBench *bench) {
+    g_array_set_size(bench->spans, 0);
+    tokenizer_scan(bench->text, bench->length, &bench->word_chars, bench->spans);
+    return bench->spans->len;
+}
+
+static gint core_bench_lines(CoreBench *bench) {
+    gint lines = 0;
+
+    line_index_build(bench->line_starts, bench->text, bench->length);
+
+    for (gint i = 0; i < bench->spans->len; i++) {
+        lines = line_index_lookup(bench->line_starts, g_array_index(bench->spans, Span, i).position);
+    }
+
+    return lines + 1;
+}
+
+static gint core_bench_match_words(CoreBench *bench) {
+    gint matches = 0;
+
+    for (gint i = 0; i < bench->spans->len; i++) {
+        Span span = g_array_index(bench->spans, Span, i);
+        matches += match_word(bench->text + span.position, span.length, bench->query, bench->query_length,
+                              &bench->options);
+    }
+
+    return matches;
+}
+
+static gint core_bench_match_substrings(CoreBench *bench) {
+    g_array_set_size(bench->positions, 0);
+    match_substrings(bench->text, bench->length, bench->query, bench->query_length, &bench->options,
+                     bench->positions);
+    return bench->positions->len;
+}
+
+static gint core_bench_labels(CoreBench *bench) {
+    gchar label[LABEL_MAX_LENGTH];
+    gint labels = 0;
+
+    for (gint i = 0; i < bench->spans->len; i++) {
+        labels += label_format(label, FALSE, FALSE, i) > 0;
+    }
+
+    return labels;
+}
+
+static gint core_bench_replace(CoreBench *bench) {
+    GString *cache = g_string_new_len(bench->text, bench->length);
+    GArray *spans = g_array_sized_new(FALSE, FALSE, sizeof(Span), bench->positions->len);
+
+    for (gint i = 0; i < bench->positions->len; i++) {
+        Span span = {g_array_index(bench->positions, gint, i), bench->query_length};
+        g_array_append_val(spans, span);
+    }
+
+    replace_cache_erase_spans(cache, spans);
+    replace_cache_insert(cache, spans, 0, "x", 1);
+    replace_cache_erase(cache, spans, 0, 1);
+
+    gint replaced = spans->len;
+
+    g_array_free(spans, TRUE);
+    g_string_free(cache, TRUE);
+
+    return replaced;
+}
+
+static gint core_bench_find_char(CoreBench *bench) {
+    g_array_set_size(bench->positions, 0);
+    utf8_scan_find_char(bench->text, bench->length, g_utf8_get_char(bench->query), bench->positions);
+    return bench->positions->len;
+}
+
+static const CoreBenchStep steps[] = {
+    {"tokenizer_scan", core_bench_tokenize},
+    {"line_index", core_bench_lines},
+    {"match_word", core_bench_match_words},
+    {"match_substrings", core_bench_match_substrings},
+    {"label_format", core_bench_labels},
+    {"replace_cache", core_bench_replace},
+    {"utf8_scan_find_char", core_bench_find_char},
+};
+
+void core_bench_run(const gchar *text, const gchar *query, gint iterations) {
+    CoreBench bench = {
+        .text = text,
+        .length = strlen(text),
+        .query = query,
+        .query_length = strlen(query),
+        .options = {.case_sensitive = TRUE, .smart_case = TRUE, .from_beginning = TRUE},
+        .spans = g_array_new(FALSE, FALSE, sizeof(Span)),
+        .positions = g_array_new(FALSE, FALSE, sizeof(gint)),
+        .line_starts = g_array_new(FALSE, FALSE, sizeof(gint)),
+    };
+
+    tokenizer_set_word_chars(&bench.word_chars, "_abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789");
+
+    printf("%-34s %8s %10s %10s %10s %10s\n", "core", "results", "min us", "median us", "mean us", "max us");
+
+    for (gint s = 0; s < G_N_ELEMENTS(steps); s++) {
+        GArray *samples = g_array_new(FALSE, FALSE, sizeof(gint64));
+        BenchResult result = {0};
+
+        for (gint i = -1; i < iterations; i++) {
+            gint64 start = g_get_monotonic_time();
+            result.targets = steps[s].run(&bench);
+            gint64 elapsed = g_get_monotonic_time() - start;
+
+            if (i >= 0) {
+                g_array_append_val(samples, elapsed);
+            }
+        }
+
+        bench_summarize(samples, &result);
+        g_array_free(samples, TRUE);
+
+        printf("%-34s %8d %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT
+               "\n",
+               steps[s].name, result.targets, result.min, result.median, result.mean, result.max);
+    }
+
+    g_array_free(bench.spans, TRUE);
+    g_array_free(bench.positions, TRUE);
+    g_array_free(bench.line_starts, TRUE);
+}
@@ -0,0 +1,83 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "corpus.h"
+
+static const gchar *identifiers[] = {"sj",        "word",         "words",       "buffer",  "cache",
+                                     "line",      "position",     "len",         "start",   "end",
+                                     "query",     "search_query", "i",           "j",       "count",
+                                     "result",    "marker",       "shortcut",    "padding", "replace_pos",
+                                     "lfs_added", "config",       "first_position"};
+
+static const gchar *utf8_identifiers[] = {"größe",  "naïve",  "café", "données", "длина",
+                                          "данные", "日本語", "変数", "λόγος"};
+
+static const gchar *keywords[] = {"if", "for", "while", "return", "static", "const", "gint", "gchar", "gboolean"};
+
+static const gchar *separators[] = {" ", " ", " ", ", ", " = ", "->", "(", ") ", " + ", " < ", "[", "] "};
+
+gchar *corpus_generate(const CorpusOptions *options) {
+    GRand *rand = g_rand_new_with_seed(options->seed);
+    GString *text = g_string_new("");
+
+    for (gint line = 0; line < options->lines; line++) {
+        if (g_rand_int_range(rand, 0, 10) == 0) {
+            g_string_append_c(text, '\n');
+            continue;
+        }
+
+        gsize line_start = text->len;
+        gint indent = g_rand_int_range(rand, 0, 4);
+        gint words = MAX(1, options->words_per_line + g_rand_int_range(rand, -2, 3));
+
+        for (gint i = 0; i < indent * 4; i++) {
+            g_string_append_c(text, ' ');
+        }
+
+        g_string_append(text, keywords[g_rand_int_range(rand, 0, G_N_ELEMENTS(keywords))]);
+
+        for (gint i = 1; i < words; i++) {
+            g_string_append(text, separators[g_rand_int_range(rand, 0, G_N_ELEMENTS(separators))]);
+
+            if (g_rand_int_range(rand, 0, 100) < options->utf8_percent) {
+                g_string_append(text, utf8_identifiers[g_rand_int_range(rand, 0, G_N_ELEMENTS(utf8_identifiers))]);
+            } else {
+                g_string_append(text, identifiers[g_rand_int_range(rand, 0, G_N_ELEMENTS(identifiers))]);
+            }
+        }
+
+        g_string_append_c(text, ';');
+
+        if (options->line_length > 0 && (gint)(text->len - line_start) + 4 < options->line_length) {
+            g_string_append(text, " // ");
+
+            while ((gint)(text->len - line_start) < options->line_length) {
+                g_string_append(text, identifiers[g_rand_int_range(rand, 0, G_N_ELEMENTS(identifiers))]);
+                g_string_append_c(text, ' ');
+            }
+        }
+
+        g_string_append_c(text, '\n');
+    }
+
+    g_rand_free(rand);
+
+    return g_string_free(text, FALSE);
+}
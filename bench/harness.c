@@ -0,0 +1,296 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "document_index.h"
+#include "harness.h"
+#include "replace_instant.h"
+#include "sci_stub.h"
+#include "search_substring.h"
+#include "search_word.h"
+#include "selection.h"
+#include "shortcut_char.h"
+#include "shortcut_common.h"
+#include "shortcut_word.h"
+#include "util.h"
+#include "values.h"
+#include "view_cache.h"
+
+/*
+ * Passes the stub's modification notifications on the way on_editor_notify does, so the line-start table, the
+ * document index and the document version follow the edits a run makes.
+ */
+static void bench_notify(ScintillaObject *sci, const SCNotification *nt, gpointer user_data) {
+    ShortcutJump *sj = (ShortcutJump *)user_data;
+
+    if (nt->nmhdr.code == SCN_MODIFIED && nt->modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT)) {
+        clear_line_starts(sj);
+        document_index_update(sj, sci, nt);
+
+        if (!sj->placing_tags) {
+            sj->document_version++;
+        }
+    }
+}
+
+ShortcutJump *bench_new_sj(gboolean whole_document) {
+    ShortcutJump *sj = g_new0(ShortcutJump, 1);
+
+    sj->geany_data = sci_stub_get_geany_data();
+
+    sj->config_settings = g_new0(Settings, 1);
+    sj->config_widgets = g_new0(Widgets, 1);
+
+    sj->config_settings->show_annotations = TRUE;
+    sj->config_settings->use_selected_word_or_char = TRUE;
+    sj->config_settings->search_from_selection = TRUE;
+    sj->config_settings->search_selection_if_line = TRUE;
+    sj->config_settings->select_when_shortcut_char = TRUE;
+    sj->config_settings->wrap_search = TRUE;
+    sj->config_settings->search_start_from_beginning = TRUE;
+    sj->config_settings->search_case_sensitive = TRUE;
+    sj->config_settings->search_smart_case = TRUE;
+    sj->config_settings->whole_document = whole_document;
+    sj->config_settings->text_after = TX_SELECT_TEXT;
+    sj->config_settings->line_after = LA_SELECT_TO_LINE;
+    sj->config_settings->replace_action = RA_REPLACE;
+    sj->config_settings->text_color = 0xFFFFFF;
+    sj->config_settings->search_annotation_bg_color = 0x46383D;
+    sj->config_settings->tag_color = 0xFFFFFF;
+    sj->config_settings->highlight_color = 0x00FF00;
+
+    sj->multicursor_menu_checkbox = sci_stub_get_menu_item();
+    sj->multicursor_menu_checkbox_signal_id =
+        g_signal_connect(sj->multicursor_menu_checkbox, "toggled", G_CALLBACK(multicursor_menu_toggled), sj);
+
+    sj->multicursor_mode = MC_DISABLED;
+    sj->previous_cursor_pos = -1;
+    sj->current_mode = JM_NONE;
+
+    sci_stub_set_notify(bench_notify, sj);
+
+    return sj;
+}
+
+void bench_free_sj(ShortcutJump *sj) {
+    sci_stub_set_notify(NULL, NULL);
+    document_index_free(sj);
+    view_cache_free(sj);
+    free_spare_values(sj);
+    g_signal_handler_disconnect(sj->multicursor_menu_checkbox, sj->multicursor_menu_checkbox_signal_id);
+
+    if (sj->has_previous_action) {
+        g_string_free(sj->previous_search_query, TRUE);
+        g_string_free(sj->previous_replace_query, TRUE);
+    }
+
+    g_free(sj->config_settings);
+    g_free(sj->config_widgets);
+    g_free(sj);
+}
+
+static void bench_begin_activation(ShortcutJump *sj, JumpMode mode) {
+    sj->current_mode = mode;
+    sj->sci = get_scintilla_object();
+    set_selection_info(sj);
+    init_sj_values(sj);
+}
+
+static gint shortcut_word_activate(ShortcutJump *sj, const BenchContext *context) {
+    shortcut_word_init(sj);
+    return sj->words->len;
+}
+
+static void shortcut_word_finish(ShortcutJump *sj, const BenchContext *context) { shortcut_word_cancel(sj); }
+
+static gint search_word_activate(ShortcutJump *sj, const BenchContext *context) {
+    bench_begin_activation(sj, JM_SEARCH);
+    search_word_get_words(sj);
+    document_index_complete(sj);
+    return sj->words->len;
+}
+
+static void search_word_finish(ShortcutJump *sj, const BenchContext *context) { search_word_end(sj); }
+
+/*
+ * Times a word search up to the point typing can start. Over the whole of a large document the words are found on a
+ * worker thread and handed to the search later, so this is how long the main thread is held. The index is dropped
+ * afterwards so every sample starts its build again.
+ */
+static gint search_word_open_activate(ShortcutJump *sj, const BenchContext *context) {
+    bench_begin_activation(sj, JM_SEARCH);
+    search_word_get_words(sj);
+    return sj->words->len;
+}
+
+static void search_word_open_finish(ShortcutJump *sj, const BenchContext *context) {
+    search_word_end(sj);
+    document_index_remove(sj, context->sci);
+}
+
+static gint search_substring_activate(ShortcutJump *sj, const BenchContext *context) {
+    bench_begin_activation(sj, JM_SUBSTRING);
+    g_string_assign(sj->search_query, context->substring_query);
+    search_substring_get_substrings(sj);
+    return sj->words->len;
+}
+
+static void search_substring_finish(ShortcutJump *sj, const BenchContext *context) { search_substring_end(sj); }
+
+static gint shortcut_char_activate(ShortcutJump *sj, const BenchContext *context) {
+    bench_begin_activation(sj, JM_SHORTCUT_CHAR_ACCEPTING);
+    shortcut_char_get_chars(sj, context->char_query);
+    return sj->words->len;
+}
+
+static void shortcut_char_finish(ShortcutJump *sj, const BenchContext *context) { shortcut_end(sj, FALSE); }
+
+/*
+ * Drives a substring replacement the way a user would: the query is typed into the activation, replacement mode is
+ * entered, a single character is typed over every match and the edit is accepted with Escape.
+ */
+static gint replace_substring_activate(ShortcutJump *sj, const BenchContext *context) {
+    gint targets;
+
+    serach_substring_init(sj);
+
+    for (const gchar *p = context->substring_query; *p != '\0'; p++) {
+        sci_stub_send_key(context->sci, gdk_unicode_to_keyval(*p), 0);
+    }
+
+    targets = sj->search_results_count;
+
+    replace_substring_init(sj);
+    sci_stub_send_key(context->sci, GDK_KEY_X, 0);
+    sci_stub_send_key(context->sci, GDK_KEY_Escape, 0);
+
+    return targets;
+}
+
+static void replace_substring_finish(ShortcutJump *sj, const BenchContext *context) {
+    if (sj->current_mode != JM_NONE) {
+        cancel_actions(sj);
+    }
+
+    sci_stub_set_text(context->sci, context->text);
+}
+
+const BenchMode bench_modes[] = {
+    {"shortcut_word_init", shortcut_word_activate, shortcut_word_finish},
+    {"search_word_get_words", search_word_activate, search_word_finish},
+    {"search_word_open", search_word_open_activate, search_word_open_finish},
+    {"search_substring_get_substrings", search_substring_activate, search_substring_finish},
+    {"shortcut_char_get_chars", shortcut_char_activate, shortcut_char_finish},
+    {"replace_substring", replace_substring_activate, replace_substring_finish},
+};
+
+const gint bench_modes_count = G_N_ELEMENTS(bench_modes);
+
+const BenchMode *bench_find_mode(const gchar *name) {
+    for (gint i = 0; i < bench_modes_count; i++) {
+        if (g_strcmp0(bench_modes[i].name, name) == 0) {
+            return &bench_modes[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Parses a comma separated list of positive counts, accepting k and m suffixes ("10k,1m").
+ */
+GArray *bench_parse_counts(const gchar *list, GError **error) {
+    GArray *counts = g_array_new(FALSE, FALSE, sizeof(gint));
+    gchar **parts = g_strsplit(list, ",", -1);
+
+    for (gchar **part = parts; *part != NULL; part++) {
+        gchar *end;
+        gint64 value = g_ascii_strtoll(*part, &end, 10);
+
+        if (*end == 'k' || *end == 'K') {
+            value *= 1000;
+            end++;
+        } else if (*end == 'm' || *end == 'M') {
+            value *= 1000000;
+            end++;
+        }
+
+        if (end == *part || *end != '\0' || value < 1 || value > G_MAXINT) {
+            g_set_error(error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE, "Invalid count \"%s\"", *part);
+            g_array_free(counts, TRUE);
+            g_strfreev(parts);
+            return NULL;
+        }
+
+        gint count = value;
+        g_array_append_val(counts, count);
+    }
+
+    g_strfreev(parts);
+
+    return counts;
+}
+
+static gint compare_samples(gconstpointer a, gconstpointer b) {
+    gint64 x = *(const gint64 *)a;
+    gint64 y = *(const gint64 *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+void bench_summarize(GArray *samples, BenchResult *result) {
+    gint64 total = 0;
+
+    g_array_sort(samples, compare_samples);
+
+    for (gint i = 0; i < samples->len; i++) {
+        total += g_array_index(samples, gint64, i);
+    }
+
+    result->min = g_array_index(samples, gint64, 0);
+    result->median = g_array_index(samples, gint64, samples->len / 2);
+    result->mean = total / samples->len;
+    result->max = g_array_index(samples, gint64, samples->len - 1);
+}
+
+void bench_measure(ShortcutJump *sj, const BenchContext *context, const BenchMode *mode, BenchResult *result) {
+    GArray *samples = g_array_new(FALSE, FALSE, sizeof(gint64));
+
+    for (gint i = -1; i < context->iterations; i++) {
+        sci_stub_set_view(context->sci, context->first_line, context->screen_lines);
+        sci_stub_reset_stats();
+
+        /* Every sample times a cold activation rather than a hit on the words the previous one left behind */
+        view_cache_clear(sj);
+
+        gint64 start = g_get_monotonic_time();
+        result->targets = mode->activate(sj, context);
+        gint64 elapsed = g_get_monotonic_time() - start;
+
+        result->messages = sci_stub_get_stats()->messages;
+        mode->finish(sj, context);
+
+        if (i >= 0) {
+            g_array_append_val(samples, elapsed);
+        }
+    }
+
+    bench_summarize(samples, result);
+    g_array_free(samples, TRUE);
+}
@@ -0,0 +1,59 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef HARNESS_H_
+#define HARNESS_H_
+
+#include "jump_to_a_word.h"
+
+typedef struct {
+    ScintillaObject *sci;
+    const gchar *text;
+    const gchar *substring_query;
+    gunichar char_query;
+    gint first_line;
+    gint screen_lines;
+    gint iterations;
+} BenchContext;
+
+typedef struct {
+    const gchar *name;
+    gint (*activate)(ShortcutJump *sj, const BenchContext *context);
+    void (*finish)(ShortcutJump *sj, const BenchContext *context);
+} BenchMode;
+
+typedef struct {
+    gint targets;
+    guint64 messages;
+    gint64 min;
+    gint64 median;
+    gint64 mean;
+    gint64 max;
+} BenchResult;
+
+extern const BenchMode bench_modes[];
+extern const gint bench_modes_count;
+
+ShortcutJump *bench_new_sj(gboolean whole_document);
+void bench_free_sj(ShortcutJump *sj);
+const BenchMode *bench_find_mode(const gchar *name);
+GArray *bench_parse_counts(const gchar *list, GError **error);
+void bench_summarize(GArray *samples, BenchResult *result);
+void bench_measure(ShortcutJump *sj, const BenchContext *context, const BenchMode *mode, BenchResult *result);
+
+#endif
@@ -0,0 +1,207 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include <plugindata.h>
+
+#include "duplicate_string.h"
+#include "harness.h"
+#include "insert_line.h"
+#include "multicursor.h"
+#include "multicursor_sweep.h"
+#include "replace_instant.h"
+#include "sci_stub.h"
+#include "search_word.h"
+#include "util.h"
+
+/*
+ * Adds a growing number of cursors through the same entry points the plugin uses (a selection per cursor, and a word
+ * search accepted with Return while multicursor mode is on) and then runs each multicursor action over them. Memory is
+ * what the cursor array and its strings hold, plus the peak resident size of the process.
+ */
+
+#define MULTICURSOR_SWEEP_NEEDLE "needle"
+
+typedef struct {
+    gint64 elapsed;
+    guint64 messages;
+} SweepTiming;
+
+static gchar *multicursor_sweep_document(gint cursors) {
+    GString *text = g_string_new("");
+
+    for (gint i = 0; i < cursors; i++) {
+        g_string_append_printf(text, "    gint value_%d = " MULTICURSOR_SWEEP_NEEDLE " + offset;\n", i);
+    }
+
+    return g_string_free(text, FALSE);
+}
+
+static gsize multicursor_sweep_bytes(ShortcutJump *sj) {
+    return sj->multicursor_words->len * sizeof(Word);
+}
+
+static glong multicursor_sweep_max_rss(void) {
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;
+}
+
+static void multicursor_sweep_begin(SweepTiming *timing, gint64 *start) {
+    sci_stub_reset_stats();
+    *start = g_get_monotonic_time();
+}
+
+static void multicursor_sweep_end(SweepTiming *timing, gint64 start) {
+    timing->elapsed = g_get_monotonic_time() - start;
+    timing->messages = sci_stub_get_stats()->messages;
+}
+
+static void multicursor_sweep_print(gint cursors, const gchar *step, gint added, const SweepTiming *timing,
+                                    gsize bytes) {
+    printf("%10d %-22s %10d %12" G_GINT64_FORMAT " %12" G_GUINT64_FORMAT " %14" G_GSIZE_FORMAT " %12ld\n", cursors,
+           step, added, timing->elapsed, timing->messages, bytes, multicursor_sweep_max_rss());
+    fflush(stdout);
+}
+
+static void multicursor_sweep_from_selection(ShortcutJump *sj, ScintillaObject *sci, gint cursors) {
+    const gchar *text = sci_stub_get_text(sci);
+    SweepTiming timing;
+    gint64 start;
+
+    multicursor_toggle(sj);
+    multicursor_sweep_begin(&timing, &start);
+
+    for (const gchar *p = strstr(text, MULTICURSOR_SWEEP_NEEDLE); p; p = strstr(p + 1, MULTICURSOR_SWEEP_NEEDLE)) {
+        multicursor_add_word_from_selection(sj, p - text, p - text + strlen(MULTICURSOR_SWEEP_NEEDLE));
+    }
+
+    multicursor_sweep_end(&timing, start);
+    multicursor_sweep_print(cursors, "add_from_selection", sj->multicursor_words->len, &timing,
+                            multicursor_sweep_bytes(sj));
+
+    multicursor_toggle(sj);
+}
+
+static gboolean multicursor_sweep_from_search(ShortcutJump *sj, ScintillaObject *sci, gint cursors, gboolean print) {
+    SweepTiming timing;
+    gint64 start;
+
+    multicursor_toggle(sj);
+    search_word_init(sj, FALSE);
+
+    for (const gchar *p = MULTICURSOR_SWEEP_NEEDLE; *p != '\0'; p++) {
+        sci_stub_send_key(sci, gdk_unicode_to_keyval(*p), 0);
+    }
+
+    multicursor_sweep_begin(&timing, &start);
+    sci_stub_send_key(sci, GDK_KEY_Return, 0);
+    multicursor_sweep_end(&timing, start);
+
+    if (print) {
+        multicursor_sweep_print(cursors, "add_from_search", sj->multicursor_words->len, &timing,
+                                multicursor_sweep_bytes(sj));
+    }
+
+    if (sj->multicursor_mode != MC_ACCEPTING) {
+        return FALSE;
+    }
+
+    if (sj->current_mode != JM_NONE) {
+        cancel_actions(sj);
+    }
+
+    return TRUE;
+}
+
+static void multicursor_sweep_action(ShortcutJump *sj, ScintillaObject *sci, const gchar *text, gint cursors,
+                                     const gchar *step, void (*action)(ShortcutJump *sj), gboolean type_key) {
+    SweepTiming timing;
+    gint64 start;
+
+    if (!multicursor_sweep_from_search(sj, sci, cursors, FALSE)) {
+        return;
+    }
+
+    gint added = sj->multicursor_words->len;
+    gsize bytes = multicursor_sweep_bytes(sj);
+
+    multicursor_sweep_begin(&timing, &start);
+    action(sj);
+
+    if (type_key && sj->current_mode != JM_NONE) {
+        sci_stub_send_key(sci, GDK_KEY_X, 0);
+    }
+
+    multicursor_sweep_end(&timing, start);
+    multicursor_sweep_print(cursors, step, added, &timing, bytes);
+
+    if (sj->current_mode != JM_NONE) {
+        sci_stub_send_key(sci, GDK_KEY_Escape, 0);
+    }
+
+    if (sj->multicursor_mode == MC_ACCEPTING) {
+        multicursor_toggle(sj);
+    }
+
+    sci_stub_set_text(sci, text);
+}
+
+gboolean multicursor_sweep_run(const MulticursorSweepOptions *options, GError **error) {
+    GArray *cursors = bench_parse_counts(options->cursors, error);
+
+    if (!cursors) {
+        return FALSE;
+    }
+
+    printf("%10s %-22s %10s %12s %12s %14s %12s\n", "cursors", "step", "added", "us", "messages", "cursor bytes",
+           "max rss kb");
+
+    for (gint i = 0; i < cursors->len; i++) {
+        gint count = g_array_index(cursors, gint, i);
+        gchar *text = multicursor_sweep_document(count);
+        ScintillaObject *sci = sci_stub_new(text);
+        ShortcutJump *sj = bench_new_sj(TRUE);
+
+        sci_stub_set_current(sci);
+        sci_stub_set_view(sci, 0, options->screen_lines);
+
+        multicursor_sweep_from_selection(sj, sci, count);
+
+        if (multicursor_sweep_from_search(sj, sci, count, TRUE)) {
+            multicursor_toggle(sj);
+        }
+
+        multicursor_sweep_action(sj, sci, text, count, "multicursor_replace", multicursor_replace, TRUE);
+        multicursor_sweep_action(sj, sci, text, count, "duplicate_string", duplicate_string_for_multicursor, FALSE);
+        multicursor_sweep_action(sj, sci, text, count, "line_insert", line_insert_from_multicursor, TRUE);
+
+        bench_free_sj(sj);
+        sci_stub_free(sci);
+        g_free(text);
+    }
+
+    g_array_free(cursors, TRUE);
+
+    return TRUE;
+}
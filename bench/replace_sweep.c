@@ -0,0 +1,222 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <plugindata.h>
+
+#include "harness.h"
+#include "paste.h"
+#include "replace_instant.h"
+#include "replace_sweep.h"
+#include "sci_stub.h"
+#include "search_substring.h"
+#include "util.h"
+
+/*
+ * Live replacement deletes the whole range between the first and last match and reinserts the rebuilt replace_cache
+ * on every key. The sweep builds documents with a known number of matches a known distance apart, enters substring
+ * replacement over the whole document and times typing, pasting, Delete and BackSpace one key at a time.
+ */
+
+#define REPLACE_SWEEP_NEEDLE "needle"
+
+typedef enum {
+    SWEEP_TYPE,
+    SWEEP_PASTE,
+    SWEEP_DELETE,
+    SWEEP_BACKSPACE,
+    SWEEP_OP_COUNT,
+} SweepOp;
+
+typedef struct {
+    gint keys;
+    gint64 total;
+    gint64 max;
+    guint64 bytes_inserted;
+    guint64 messages;
+} SweepStats;
+
+static const gchar *op_names[] = {
+    [SWEEP_TYPE] = "type",
+    [SWEEP_PASTE] = "paste",
+    [SWEEP_DELETE] = "delete",
+    [SWEEP_BACKSPACE] = "backspace",
+};
+
+static const gchar filler[] = "lorem ipsum dolor sit amet consectetur adipiscing elit sed do eiusmod tempor ";
+
+static gchar *replace_sweep_document(gint occurrences, gint spacing) {
+    GString *text = g_string_new("");
+    gint column = 0;
+
+    for (gint i = 0; i < occurrences; i++) {
+        g_string_append(text, REPLACE_SWEEP_NEEDLE);
+        column += strlen(REPLACE_SWEEP_NEEDLE);
+
+        for (gint j = 0; j < spacing; j++) {
+            if (column >= 80 && text->str[text->len - 1] == ' ') {
+                g_string_append_c(text, '\n');
+                column = 0;
+            } else {
+                g_string_append_c(text, filler[j % (sizeof(filler) - 1)]);
+                column++;
+            }
+        }
+    }
+
+    g_string_append_c(text, '\n');
+
+    return g_string_free(text, FALSE);
+}
+
+static void replace_sweep_record(SweepStats *stats, gint64 start) {
+    gint64 elapsed = g_get_monotonic_time() - start;
+
+    stats->keys++;
+    stats->total += elapsed;
+    stats->max = MAX(stats->max, elapsed);
+    stats->bytes_inserted += sci_stub_get_stats()->bytes_inserted;
+    stats->messages += sci_stub_get_stats()->messages;
+}
+
+static void replace_sweep_key(ScintillaObject *sci, SweepStats *stats, guint keyval) {
+    sci_stub_reset_stats();
+
+    gint64 start = g_get_monotonic_time();
+    sci_stub_send_key(sci, keyval, 0);
+    replace_sweep_record(stats, start);
+}
+
+static void replace_sweep_paste(ShortcutJump *sj, SweepStats *stats) {
+    sj->paste_key_release_id =
+        g_signal_connect(sj->sci, "key-release-event", G_CALLBACK(on_paste_key_release_replace), sj);
+    sj->inserting_clipboard = TRUE;
+    sci_stub_reset_stats();
+
+    gint64 start = g_get_monotonic_time();
+    on_paste_key_release_replace(NULL, NULL, sj);
+    replace_sweep_record(stats, start);
+}
+
+static gint replace_sweep_case(gint occurrences, gint spacing, gint length, gint screen_lines,
+                               SweepStats stats[SWEEP_OP_COUNT]) {
+    gchar *text = replace_sweep_document(occurrences, spacing);
+    gchar *paste = g_strnfill(length, 'p');
+    ScintillaObject *sci = sci_stub_new(text);
+    ShortcutJump *sj = bench_new_sj(TRUE);
+    gint matches;
+
+    sci_stub_set_current(sci);
+    sci_stub_set_view(sci, 0, screen_lines);
+    sci_stub_set_clipboard(paste);
+
+    serach_substring_init(sj);
+
+    for (const gchar *p = REPLACE_SWEEP_NEEDLE; *p != '\0'; p++) {
+        sci_stub_send_key(sci, gdk_unicode_to_keyval(*p), 0);
+    }
+
+    matches = sj->search_results_count;
+    replace_substring_init(sj);
+
+    if (sj->current_mode == JM_REPLACE_SUBSTRING) {
+        for (gint i = 0; i < length; i++) {
+            replace_sweep_key(sci, &stats[SWEEP_TYPE], GDK_KEY_a + i % 26);
+        }
+
+        replace_sweep_paste(sj, &stats[SWEEP_PASTE]);
+
+        for (gint i = 0; i < MIN(length, spacing / 2); i++) {
+            replace_sweep_key(sci, &stats[SWEEP_DELETE], GDK_KEY_Delete);
+        }
+
+        for (gint i = 0; i < length && sj->replace_len > 1; i++) {
+            replace_sweep_key(sci, &stats[SWEEP_BACKSPACE], GDK_KEY_BackSpace);
+        }
+
+        sci_stub_send_key(sci, GDK_KEY_Escape, 0);
+    }
+
+    if (sj->current_mode != JM_NONE) {
+        cancel_actions(sj);
+    }
+
+    sci_stub_set_clipboard(NULL);
+    bench_free_sj(sj);
+    sci_stub_free(sci);
+    g_free(paste);
+    g_free(text);
+
+    return matches;
+}
+
+gboolean replace_sweep_run(const ReplaceSweepOptions *options, GError **error) {
+    GArray *occurrences = bench_parse_counts(options->occurrences, error);
+    GArray *spacings = occurrences ? bench_parse_counts(options->spacings, error) : NULL;
+    GArray *lengths = spacings ? bench_parse_counts(options->lengths, error) : NULL;
+
+    if (!lengths) {
+        if (occurrences) {
+            g_array_free(occurrences, TRUE);
+        }
+
+        if (spacings) {
+            g_array_free(spacings, TRUE);
+        }
+
+        return FALSE;
+    }
+
+    printf("%8s %8s %8s %12s %-10s %6s %10s %10s %14s %10s\n", "matches", "spacing", "length", "range bytes", "key",
+           "keys", "mean us", "max us", "inserted/key", "msgs/key");
+
+    for (gint o = 0; o < occurrences->len; o++) {
+        for (gint s = 0; s < spacings->len; s++) {
+            for (gint l = 0; l < lengths->len; l++) {
+                gint count = g_array_index(occurrences, gint, o);
+                gint spacing = g_array_index(spacings, gint, s);
+                gint length = g_array_index(lengths, gint, l);
+                SweepStats stats[SWEEP_OP_COUNT] = {{0}};
+                gint matches = replace_sweep_case(count, spacing, length, options->screen_lines, stats);
+                gint range = (count - 1) * (spacing + strlen(REPLACE_SWEEP_NEEDLE)) + strlen(REPLACE_SWEEP_NEEDLE);
+
+                for (gint op = 0; op < SWEEP_OP_COUNT; op++) {
+                    if (stats[op].keys == 0) {
+                        continue;
+                    }
+
+                    printf("%8d %8d %8d %12d %-10s %6d %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT
+                           " %14" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT "\n",
+                           matches, spacing, length, range, op_names[op], stats[op].keys,
+                           stats[op].total / stats[op].keys, stats[op].max, stats[op].bytes_inserted / stats[op].keys,
+                           stats[op].messages / stats[op].keys);
+                }
+
+                fflush(stdout);
+            }
+        }
+    }
+
+    g_array_free(occurrences, TRUE);
+    g_array_free(spacings, TRUE);
+    g_array_free(lengths, TRUE);
+
+    return TRUE;
+}
@@ -0,0 +1,257 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <plugindata.h>
+
+#include "jump_to_a_word.h"
+#include "preferences.h"
+#include "replace_instant.h"
+#include "replay.h"
+#include "sci_stub.h"
+#include "search_substring.h"
+#include "search_word.h"
+#include "selection.h"
+#include "shortcut_char.h"
+#include "shortcut_line.h"
+#include "shortcut_word.h"
+#include "util.h"
+
+/*
+ * Replays a recording made with "Record Interactions": the document, view and selection are restored, the recorded
+ * activation is run and each key is emitted on the stand-in editor so it reaches whichever handler the plugin has
+ * connected at that point.
+ */
+
+typedef struct {
+    gchar *mode;
+    gint argument;
+    gchar *text;
+    gint first_visible_line;
+    gint lines_on_screen;
+    gint anchor;
+    gint current_pos;
+    gint *keyvals;
+    gint *states;
+    gsize keys;
+} Recording;
+
+typedef struct {
+    const gchar *name;
+    void (*activate)(ShortcutJump *sj, gint argument);
+} ReplayMode;
+
+static const gchar *mode_names[] = {
+    [JM_SHORTCUT_WORD] = "shortcut word",
+    [JM_SHORTCUT_CHAR_JUMPING] = "char jumping",
+    [JM_SHORTCUT_CHAR_ACCEPTING] = "char accepting",
+    [JM_SHORTCUT_CHAR_REPLACING] = "char replacing",
+    [JM_SEARCH] = "search",
+    [JM_REPLACE_SEARCH] = "replace search",
+    [JM_SUBSTRING] = "substring",
+    [JM_REPLACE_SUBSTRING] = "replace substring",
+    [JM_LINE] = "line",
+    [JM_INSERTING_LINE] = "inserting line",
+    [JM_INSERTING_LINE_MULTICURSOR] = "inserting line mc",
+    [JM_REPLACE_MULTICURSOR] = "replace mc",
+    [JM_TRANSPOSE_MULTICURSOR] = "transpose mc",
+    [JM_DUPLICATE] = "duplicate",
+    [JM_DUPLICATE_MULTICURSOR] = "duplicate mc",
+    [JM_NONE] = "none",
+};
+
+static void replay_free_recording(Recording *recording) {
+    g_free(recording->mode);
+    g_free(recording->text);
+    g_free(recording->keyvals);
+    g_free(recording->states);
+}
+
+static gboolean replay_load(GKeyFile *config, Recording *recording, GError **error) {
+    gsize states = 0;
+
+    recording->mode = g_key_file_get_string(config, "recording", "mode", error);
+
+    if (!recording->mode) {
+        return FALSE;
+    }
+
+    recording->text = g_key_file_get_string(config, "recording", "text", error);
+
+    if (!recording->text) {
+        return FALSE;
+    }
+
+    recording->argument = g_key_file_get_integer(config, "recording", "argument", NULL);
+    recording->first_visible_line = g_key_file_get_integer(config, "recording", "first_visible_line", NULL);
+    recording->lines_on_screen = g_key_file_get_integer(config, "recording", "lines_on_screen", NULL);
+    recording->anchor = g_key_file_get_integer(config, "recording", "anchor", NULL);
+    recording->current_pos = g_key_file_get_integer(config, "recording", "current_pos", NULL);
+    recording->keyvals = g_key_file_get_integer_list(config, "keys", "keyval", &recording->keys, NULL);
+    recording->states = g_key_file_get_integer_list(config, "keys", "state", &states, NULL);
+
+    if (states != recording->keys) {
+        g_set_error(error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE, "keyval and state lists differ");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void replay_shortcut_word(ShortcutJump *sj, gint argument) { shortcut_word_init(sj); }
+
+static void replay_shortcut_char(ShortcutJump *sj, gint argument) { shortcut_char_init(sj); }
+
+static void replay_shortcut_char_with_query(ShortcutJump *sj, gint argument) {
+    set_selection_info(sj);
+    shortcut_char_init_with_query(sj, argument);
+}
+
+static void replay_shortcut_line(ShortcutJump *sj, gint argument) { shortcut_line_init(sj); }
+
+static void replay_search_word(ShortcutJump *sj, gint argument) { search_word_init(sj, argument); }
+
+static void replay_search_substring(ShortcutJump *sj, gint argument) { serach_substring_init(sj); }
+
+static void replay_replace_instant(ShortcutJump *sj, gint argument) { replace_instant_init(sj); }
+
+static const ReplayMode replay_modes[] = {
+    {"shortcut_word", replay_shortcut_word},
+    {"shortcut_char", replay_shortcut_char},
+    {"shortcut_char_with_query", replay_shortcut_char_with_query},
+    {"shortcut_line", replay_shortcut_line},
+    {"search_word", replay_search_word},
+    {"search_substring", replay_search_substring},
+    {"replace_instant", replay_replace_instant},
+};
+
+static const ReplayMode *replay_find_mode(const gchar *name) {
+    for (gint i = 0; i < G_N_ELEMENTS(replay_modes); i++) {
+        if (g_strcmp0(replay_modes[i].name, name) == 0) {
+            return &replay_modes[i];
+        }
+    }
+
+    return NULL;
+}
+
+static gint compare_samples(gconstpointer a, gconstpointer b) {
+    gint64 x = *(const gint64 *)a;
+    gint64 y = *(const gint64 *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static void replay_print_row(const gchar *event, const gchar *key, JumpMode mode, guint64 messages, GArray *samples) {
+    g_array_sort(samples, compare_samples);
+
+    printf("%-10s %-14s %-18s %10" G_GUINT64_FORMAT " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT
+           " %10" G_GINT64_FORMAT "\n",
+           event, key, mode_names[mode], messages, g_array_index(samples, gint64, 0),
+           g_array_index(samples, gint64, samples->len / 2), g_array_index(samples, gint64, samples->len - 1));
+}
+
+gboolean replay_run(ShortcutJump *sj, ScintillaObject *sci, const gchar *path, gint iterations, GError **error) {
+    GKeyFile *config = g_key_file_new();
+    Recording recording = {0};
+
+    if (!g_key_file_load_from_file(config, path, G_KEY_FILE_NONE, error) || !replay_load(config, &recording, error)) {
+        replay_free_recording(&recording);
+        g_key_file_free(config);
+        return FALSE;
+    }
+
+    load_settings(sj, config);
+    g_key_file_free(config);
+
+    const ReplayMode *mode = replay_find_mode(recording.mode);
+
+    if (!mode) {
+        g_set_error(error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE, "unknown mode \"%s\"", recording.mode);
+        replay_free_recording(&recording);
+        return FALSE;
+    }
+
+    gsize events = recording.keys + 1;
+    GArray **samples = g_new(GArray *, events);
+    guint64 *messages = g_new0(guint64, events);
+    JumpMode *modes = g_new(JumpMode, events);
+
+    for (gsize i = 0; i < events; i++) {
+        samples[i] = g_array_new(FALSE, FALSE, sizeof(gint64));
+    }
+
+    for (gint iteration = -1; iteration < iterations; iteration++) {
+        sci_stub_set_text(sci, recording.text);
+        sci_stub_set_view(sci, recording.first_visible_line, recording.lines_on_screen);
+        scintilla_send_message(sci, SCI_SETSEL, recording.anchor, recording.current_pos);
+
+        for (gsize i = 0; i < events; i++) {
+            sci_stub_reset_stats();
+
+            gint64 start = g_get_monotonic_time();
+
+            if (i == 0) {
+                mode->activate(sj, recording.argument);
+            } else {
+                sci_stub_send_key(sci, recording.keyvals[i - 1], recording.states[i - 1]);
+            }
+
+            gint64 elapsed = g_get_monotonic_time() - start;
+
+            messages[i] = sci_stub_get_stats()->messages;
+            modes[i] = sj->current_mode;
+
+            if (iteration >= 0) {
+                g_array_append_val(samples[i], elapsed);
+            }
+        }
+
+        if (sj->current_mode != JM_NONE) {
+            cancel_actions(sj);
+        }
+    }
+
+    printf("%s: %s, %" G_GSIZE_FORMAT " keys, %d bytes, %d iterations\n\n", path, recording.mode, recording.keys,
+           sci_stub_get_length(sci), iterations);
+    printf("%-10s %-14s %-18s %10s %10s %10s %10s\n", "event", "key", "mode after", "messages", "min us", "median us",
+           "max us");
+
+    replay_print_row("activate", recording.mode, modes[0], messages[0], samples[0]);
+
+    for (gsize i = 1; i < events; i++) {
+        gchar *event = g_strdup_printf("key %" G_GSIZE_FORMAT, i);
+        const gchar *name = gdk_keyval_name(recording.keyvals[i - 1]);
+
+        replay_print_row(event, name ? name : "?", modes[i], messages[i], samples[i]);
+        g_free(event);
+    }
+
+    for (gsize i = 0; i < events; i++) {
+        g_array_free(samples[i], TRUE);
+    }
+
+    g_free(samples);
+    g_free(messages);
+    g_free(modes);
+    replay_free_recording(&recording);
+
+    return TRUE;
+}
@@ -0,0 +1,123 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+
+#include <plugindata.h>
+
+#include "corpus.h"
+#include "harness.h"
+#include "sci_stub.h"
+#include "scaling.h"
+
+/*
+ * Runs the whole-document activations over progressively larger synthetic documents. Replacement edits every match
+ * and the stand-in editor keeps its text in a flat buffer, so unless asked otherwise it only replaces on screen.
+ */
+
+static const gchar *scaling_modes[] = {"search_word_get_words", "search_word_open", "search_substring_get_substrings",
+                                       "shortcut_char_get_chars", "replace_substring"};
+
+static void scaling_json_result(GString *json, const gchar *name, gboolean whole_document, const BenchResult *result,
+                                gboolean last) {
+    g_string_append_printf(json,
+                           "        {\"mode\": \"%s\", \"whole_document\": %s, \"targets\": %d, "
+                           "\"messages\": %" G_GUINT64_FORMAT ", \"min_us\": %" G_GINT64_FORMAT
+                           ", \"median_us\": %" G_GINT64_FORMAT ", \"mean_us\": %" G_GINT64_FORMAT
+                           ", \"max_us\": %" G_GINT64_FORMAT "}%s\n",
+                           name, whole_document ? "true" : "false", result->targets, result->messages, result->min,
+                           result->median, result->mean, result->max, last ? "" : ",");
+}
+
+gboolean scaling_run(const ScalingOptions *options, GError **error) {
+    GArray *sizes = bench_parse_counts(options->sizes, error);
+
+    if (!sizes) {
+        return FALSE;
+    }
+
+    GString *json = g_string_new("{\n");
+    ShortcutJump *whole = bench_new_sj(TRUE);
+    ShortcutJump *screen = bench_new_sj(FALSE);
+
+    g_string_append_printf(json,
+                           "  \"corpus\": {\"words_per_line\": %d, \"line_length\": %d, \"utf8_percent\": %d, "
+                           "\"seed\": %u},\n",
+                           options->corpus.words_per_line, options->corpus.line_length, options->corpus.utf8_percent,
+                           options->corpus.seed);
+    g_string_append_printf(json, "  \"screen_lines\": %d,\n  \"iterations\": %d,\n  \"sizes\": [\n",
+                           options->context.screen_lines, options->context.iterations);
+
+    printf("%10s %12s %-34s %8s %10s %10s %10s %10s %10s\n", "lines", "bytes", "activation", "targets", "messages",
+           "min us", "median us", "mean us", "max us");
+
+    for (gint i = 0; i < sizes->len; i++) {
+        CorpusOptions corpus = options->corpus;
+        BenchContext context = options->context;
+
+        corpus.lines = g_array_index(sizes, gint, i);
+
+        gchar *text = corpus_generate(&corpus);
+        ScintillaObject *sci = sci_stub_new(text);
+
+        sci_stub_set_current(sci);
+        context.sci = sci;
+        context.text = text;
+        context.first_line = corpus.lines / 2;
+
+        g_string_append_printf(json, "    {\n      \"lines\": %d,\n      \"bytes\": %d,\n      \"modes\": [\n",
+                               corpus.lines, sci_stub_get_length(sci));
+
+        for (gint m = 0; m < G_N_ELEMENTS(scaling_modes); m++) {
+            const BenchMode *mode = bench_find_mode(scaling_modes[m]);
+            gboolean whole_document =
+                g_strcmp0(mode->name, "replace_substring") != 0 || options->replace_whole_document;
+            BenchResult result;
+
+            bench_measure(whole_document ? whole : screen, &context, mode, &result);
+
+            printf("%10d %12d %-34s %8d %10" G_GUINT64_FORMAT " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT
+                   " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT "\n",
+                   corpus.lines, sci_stub_get_length(sci), mode->name, result.targets, result.messages, result.min,
+                   result.median, result.mean, result.max);
+            fflush(stdout);
+
+            scaling_json_result(json, mode->name, whole_document, &result, m == G_N_ELEMENTS(scaling_modes) - 1);
+        }
+
+        g_string_append_printf(json, "      ]\n    }%s\n", i == sizes->len - 1 ? "" : ",");
+
+        sci_stub_free(sci);
+        g_free(text);
+    }
+
+    g_string_append(json, "  ]\n}\n");
+
+    gboolean written = g_file_set_contents(options->json_path, json->str, json->len, error);
+
+    if (written) {
+        printf("\nReport written to %s\n", options->json_path);
+    }
+
+    bench_free_sj(whole);
+    bench_free_sj(screen);
+    g_string_free(json, TRUE);
+    g_array_free(sizes, TRUE);
+
+    return written;
+}
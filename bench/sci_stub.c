@@ -0,0 +1,750 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <errno.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include <glib/gstdio.h>
+#include <plugindata.h>
+
+#include "sci_stub.h"
+
+/*
+ * A headless stand-in for the ScintillaObject and the parts of the Geany API the plugin calls. The document lives in
+ * a GString and every SCI_* message the plugin sends is answered from it, so the real mode code can be driven and
+ * timed without a display. Signals with the GtkWidget names are registered so connect_key_press_action and
+ * connect_click_action work unchanged.
+ */
+
+#define SCI_STUB_UNDO_LIMIT 8
+
+typedef enum {
+    CC_SPACE,
+    CC_NEWLINE,
+    CC_WORD,
+    CC_PUNCTUATION,
+} CharClass;
+
+typedef struct {
+    GObject parent;
+
+    GString *text;
+    GArray *line_starts;
+    gboolean lines_dirty;
+    CharClass char_classes[128];
+
+    gint first_visible_line;
+    gint lines_on_screen;
+    gint anchor;
+    gint current_pos;
+    gint target_start;
+    gint target_end;
+    gint indicator_current;
+
+    gboolean read_only;
+    gint undo_depth;
+    GPtrArray *undo_stack;
+} SciStub;
+
+typedef struct {
+    GObjectClass parent_class;
+} SciStubClass;
+
+G_DEFINE_TYPE(SciStub, sci_stub, G_TYPE_OBJECT)
+
+static SciStubStats stats;
+static gboolean verbose = FALSE;
+
+static SciStub *current = NULL;
+static GObject *main_window = NULL;
+static GObject *menu_item = NULL;
+static gchar *clipboard_text = NULL;
+static gpointer plugin_data = NULL;
+static SciStubNotify notify = NULL;
+static gpointer notify_data = NULL;
+
+static GeanyApp app;
+static GeanyMainWidgets main_widgets;
+static GeanyData geany_data_stub;
+static GeanyEditor editor;
+static GeanyDocument document;
+
+static void sci_stub_set_default_word_chars(SciStub *stub, gboolean include_word_class) {
+    for (gint ch = 0; ch < 128; ch++) {
+        if (ch == '\r' || ch == '\n') {
+            stub->char_classes[ch] = CC_NEWLINE;
+        } else if (ch < 0x20 || ch == ' ') {
+            stub->char_classes[ch] = CC_SPACE;
+        } else if (include_word_class && (g_ascii_isalnum(ch) || ch == '_')) {
+            stub->char_classes[ch] = CC_WORD;
+        } else {
+            stub->char_classes[ch] = CC_PUNCTUATION;
+        }
+    }
+}
+
+static void sci_stub_free_snapshot(gpointer snapshot) { g_string_free((GString *)snapshot, TRUE); }
+
+static void sci_stub_finalize(GObject *object) {
+    SciStub *stub = (SciStub *)object;
+
+    g_string_free(stub->text, TRUE);
+    g_array_free(stub->line_starts, TRUE);
+    g_ptr_array_free(stub->undo_stack, TRUE);
+
+    G_OBJECT_CLASS(sci_stub_parent_class)->finalize(object);
+}
+
+static void sci_stub_class_init(SciStubClass *klass) {
+    GObjectClass *object_class = G_OBJECT_CLASS(klass);
+
+    object_class->finalize = sci_stub_finalize;
+
+    g_signal_new("key-press-event", G_TYPE_FROM_CLASS(klass), G_SIGNAL_RUN_LAST, 0, g_signal_accumulator_true_handled,
+                 NULL, NULL, G_TYPE_BOOLEAN, 1, G_TYPE_POINTER);
+    g_signal_new("key-release-event", G_TYPE_FROM_CLASS(klass), G_SIGNAL_RUN_LAST, 0,
+                 g_signal_accumulator_true_handled, NULL, NULL, G_TYPE_BOOLEAN, 1, G_TYPE_POINTER);
+    g_signal_new("event", G_TYPE_FROM_CLASS(klass), G_SIGNAL_RUN_LAST, 0, g_signal_accumulator_true_handled, NULL,
+                 NULL, G_TYPE_BOOLEAN, 1, G_TYPE_POINTER);
+    g_signal_new("toggled", G_TYPE_FROM_CLASS(klass), G_SIGNAL_RUN_FIRST, 0, NULL, NULL, NULL, G_TYPE_NONE, 0);
+}
+
+static void sci_stub_init(SciStub *stub) {
+    stub->text = g_string_new("");
+    stub->line_starts = g_array_new(FALSE, FALSE, sizeof(gint));
+    stub->lines_dirty = TRUE;
+    stub->lines_on_screen = 60;
+    stub->undo_stack = g_ptr_array_new_with_free_func(sci_stub_free_snapshot);
+
+    sci_stub_set_default_word_chars(stub, TRUE);
+}
+
+static void sci_stub_index_lines(SciStub *stub) {
+    if (!stub->lines_dirty) {
+        return;
+    }
+
+    gint start = 0;
+
+    g_array_set_size(stub->line_starts, 0);
+    g_array_append_val(stub->line_starts, start);
+
+    for (gint i = 0; i < stub->text->len; i++) {
+        if (stub->text->str[i] == '\n') {
+            start = i + 1;
+            g_array_append_val(stub->line_starts, start);
+        }
+    }
+
+    stub->lines_dirty = FALSE;
+}
+
+static gint sci_stub_line_count(SciStub *stub) {
+    sci_stub_index_lines(stub);
+    return stub->line_starts->len;
+}
+
+static gint sci_stub_line_start(SciStub *stub, gint line) {
+    sci_stub_index_lines(stub);
+
+    if (line >= stub->line_starts->len) {
+        return stub->text->len;
+    }
+
+    return g_array_index(stub->line_starts, gint, line);
+}
+
+static gint sci_stub_line_end(SciStub *stub, gint line) {
+    sci_stub_index_lines(stub);
+
+    if (line + 1 >= stub->line_starts->len) {
+        return stub->text->len;
+    }
+
+    return g_array_index(stub->line_starts, gint, line + 1) - 1;
+}
+
+static gint sci_stub_line_from_position(SciStub *stub, gint pos) {
+    sci_stub_index_lines(stub);
+
+    gint low = 0;
+    gint high = stub->line_starts->len - 1;
+
+    while (low < high) {
+        gint mid = low + (high - low + 1) / 2;
+
+        if (g_array_index(stub->line_starts, gint, mid) <= pos) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    return low;
+}
+
+static CharClass sci_stub_char_class(SciStub *stub, gint pos) {
+    guchar ch = stub->text->str[pos];
+
+    return ch >= 0x80 ? CC_WORD : stub->char_classes[ch];
+}
+
+static gint sci_stub_word_start(SciStub *stub, gint pos, gboolean only_word_chars) {
+    CharClass cls = CC_WORD;
+
+    pos = CLAMP(pos, 0, (gint)stub->text->len);
+
+    if (!only_word_chars && pos > 0) {
+        cls = sci_stub_char_class(stub, pos - 1);
+    }
+
+    while (pos > 0 && sci_stub_char_class(stub, pos - 1) == cls) {
+        pos--;
+    }
+
+    return pos;
+}
+
+static gint sci_stub_word_end(SciStub *stub, gint pos, gboolean only_word_chars) {
+    CharClass cls = CC_WORD;
+
+    pos = CLAMP(pos, 0, (gint)stub->text->len);
+
+    if (!only_word_chars && pos < stub->text->len) {
+        cls = sci_stub_char_class(stub, pos);
+    }
+
+    while (pos < stub->text->len && sci_stub_char_class(stub, pos) == cls) {
+        pos++;
+    }
+
+    return pos;
+}
+
+static gint sci_stub_get_word_chars(SciStub *stub, gchar *buffer) {
+    gint count = 0;
+
+    for (gint ch = 0; ch < 128; ch++) {
+        if (stub->char_classes[ch] == CC_WORD) {
+            if (buffer) {
+                buffer[count] = ch;
+            }
+
+            count++;
+        }
+    }
+
+    if (buffer) {
+        buffer[count] = '\0';
+    }
+
+    return count;
+}
+
+static void sci_stub_set_word_chars(SciStub *stub, const gchar *chars) {
+    sci_stub_set_default_word_chars(stub, chars == NULL);
+
+    for (const gchar *p = chars; p && *p != '\0'; p++) {
+        if ((guchar)*p < 128) {
+            stub->char_classes[(guchar)*p] = CC_WORD;
+        }
+    }
+}
+
+static gint sci_stub_shift_position(gint p, gint pos, gint length, gint text_length) {
+    if (p >= pos + length && p > pos) {
+        return p + text_length - length;
+    }
+
+    if (p > pos) {
+        return pos;
+    }
+
+    return p;
+}
+
+/*
+ * Reports a change the way Scintilla does through SCN_MODIFIED, after the text has changed, so the plugin's editor
+ * notification handling sees the edits the bench makes.
+ */
+static void sci_stub_notify_modified(SciStub *stub, gint modification_type, gint pos, gint length) {
+    if (!notify || length == 0) {
+        return;
+    }
+
+    SCNotification nt = {0};
+
+    nt.nmhdr.code = SCN_MODIFIED;
+    nt.modificationType = modification_type;
+    nt.position = pos;
+    nt.length = length;
+
+    notify((ScintillaObject *)stub, &nt, notify_data);
+}
+
+static gboolean sci_stub_replace(SciStub *stub, gint pos, gint length, const gchar *text, gint text_length) {
+    if (stub->read_only) {
+        stats.rejected_edits++;
+        return FALSE;
+    }
+
+    pos = CLAMP(pos, 0, (gint)stub->text->len);
+    length = CLAMP(length, 0, (gint)stub->text->len - pos);
+
+    stub->anchor = sci_stub_shift_position(stub->anchor, pos, length, text_length);
+    stub->current_pos = sci_stub_shift_position(stub->current_pos, pos, length, text_length);
+
+    g_string_erase(stub->text, pos, length);
+    stub->lines_dirty = TRUE;
+    sci_stub_notify_modified(stub, SC_MOD_DELETETEXT, pos, length);
+
+    g_string_insert_len(stub->text, pos, text, text_length);
+    stub->lines_dirty = TRUE;
+    sci_stub_notify_modified(stub, SC_MOD_INSERTTEXT, pos, text_length);
+
+    stats.bytes_deleted += length;
+    stats.bytes_inserted += text_length;
+
+    return TRUE;
+}
+
+static void sci_stub_begin_undo_action(SciStub *stub) {
+    if (stub->undo_depth++ > 0) {
+        return;
+    }
+
+    if (stub->undo_stack->len == SCI_STUB_UNDO_LIMIT) {
+        g_ptr_array_remove_index(stub->undo_stack, 0);
+    }
+
+    g_ptr_array_add(stub->undo_stack, g_string_new_len(stub->text->str, stub->text->len));
+}
+
+static void sci_stub_undo(SciStub *stub) {
+    if (stub->read_only || stub->undo_stack->len == 0) {
+        return;
+    }
+
+    GString *snapshot = g_ptr_array_steal_index(stub->undo_stack, stub->undo_stack->len - 1);
+    gint length = stub->text->len;
+
+    stats.bytes_deleted += stub->text->len;
+    stats.bytes_inserted += snapshot->len;
+    stats.undo_actions++;
+
+    g_string_truncate(stub->text, 0);
+    stub->lines_dirty = TRUE;
+    sci_stub_notify_modified(stub, SC_MOD_DELETETEXT | SC_PERFORMED_UNDO, 0, length);
+
+    g_string_free(stub->text, TRUE);
+    stub->text = snapshot;
+    stub->lines_dirty = TRUE;
+    stub->anchor = MIN(stub->anchor, (gint)stub->text->len);
+    stub->current_pos = MIN(stub->current_pos, (gint)stub->text->len);
+    sci_stub_notify_modified(stub, SC_MOD_INSERTTEXT | SC_PERFORMED_UNDO, 0, stub->text->len);
+}
+
+/* The stub has no lexer, so all of its text is in style 0 */
+static gint sci_stub_get_styled_text(SciStub *stub, struct Sci_TextRange *range) {
+    gint start = CLAMP(range->chrg.cpMin, 0, (gint)stub->text->len);
+    gint end = CLAMP(range->chrg.cpMax, start, (gint)stub->text->len);
+
+    for (gint i = start; i < end; i++) {
+        range->lpstrText[2 * (i - start)] = stub->text->str[i];
+        range->lpstrText[2 * (i - start) + 1] = 0;
+    }
+
+    range->lpstrText[2 * (end - start)] = '\0';
+    range->lpstrText[2 * (end - start) + 1] = '\0';
+
+    stats.bytes_copied += end - start;
+    return 2 * (end - start);
+}
+
+sptr_t scintilla_send_message(ScintillaObject *sci, unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
+    SciStub *stub = (SciStub *)sci;
+    gint len = stub->text->len;
+    gint w = (gint)wParam;
+    gint l = (gint)lParam;
+
+    stats.messages++;
+
+    switch (iMessage) {
+    case SCI_GETLENGTH:
+        return len;
+    case SCI_GETCHARACTERPOINTER:
+        return (sptr_t)stub->text->str;
+    case SCI_GETRANGEPOINTER:
+        return (sptr_t)(stub->text->str + CLAMP(w, 0, len));
+    case SCI_GETSTYLEDTEXT:
+        return sci_stub_get_styled_text(stub, (struct Sci_TextRange *)lParam);
+    case SCI_GETCHARAT:
+        return w < 0 || w >= len ? 0 : stub->text->str[w];
+    case SCI_WORDSTARTPOSITION:
+        return sci_stub_word_start(stub, w, lParam != 0);
+    case SCI_WORDENDPOSITION:
+        return sci_stub_word_end(stub, w, lParam != 0);
+    case SCI_GETWORDCHARS:
+        return sci_stub_get_word_chars(stub, (gchar *)lParam);
+    case SCI_SETWORDCHARS:
+        sci_stub_set_word_chars(stub, (const gchar *)lParam);
+        return 0;
+    case SCI_GETLINECOUNT:
+        return sci_stub_line_count(stub);
+    case SCI_LINEFROMPOSITION:
+        return sci_stub_line_from_position(stub, w);
+    case SCI_POSITIONFROMLINE:
+        if (w < 0) {
+            return sci_stub_line_start(stub, sci_stub_line_from_position(stub, MIN(stub->anchor, stub->current_pos)));
+        }
+        return w > sci_stub_line_count(stub) ? -1 : sci_stub_line_start(stub, w);
+    case SCI_GETLINEENDPOSITION:
+        return sci_stub_line_end(stub, CLAMP(w, 0, sci_stub_line_count(stub) - 1));
+    case SCI_LINELENGTH:
+        return sci_stub_line_start(stub, w + 1) - sci_stub_line_start(stub, w);
+    case SCI_GETFIRSTVISIBLELINE:
+        return stub->first_visible_line;
+    case SCI_SETFIRSTVISIBLELINE:
+        stub->first_visible_line = CLAMP(w, 0, sci_stub_line_count(stub) - 1);
+        return 0;
+    case SCI_LINESONSCREEN:
+        return stub->lines_on_screen;
+    case SCI_DOCLINEFROMVISIBLE:
+    case SCI_VISIBLEFROMDOCLINE:
+        return w;
+    case SCI_WRAPCOUNT:
+        return 1;
+    case SCI_GETCURRENTPOS:
+        return stub->current_pos;
+    case SCI_SETCURRENTPOS:
+        stub->current_pos = CLAMP(w, 0, len);
+        return 0;
+    case SCI_GOTOPOS:
+        stub->anchor = stub->current_pos = CLAMP(w, 0, len);
+        return 0;
+    case SCI_SETSEL:
+        stub->anchor = CLAMP(w, 0, len);
+        stub->current_pos = l < 0 ? len : CLAMP(l, 0, len);
+        return 0;
+    case SCI_GETSELECTIONSTART:
+        return MIN(stub->anchor, stub->current_pos);
+    case SCI_GETSELECTIONEND:
+        return MAX(stub->anchor, stub->current_pos);
+    case SCI_SETTARGETSTART:
+        stub->target_start = CLAMP(w, 0, len);
+        return 0;
+    case SCI_SETTARGETEND:
+        stub->target_end = CLAMP(w, 0, len);
+        return 0;
+    case SCI_REPLACETARGET: {
+        const gchar *text = (const gchar *)lParam;
+        gint text_length = w < 0 ? (gint)strlen(text) : w;
+
+        if (sci_stub_replace(stub, stub->target_start, stub->target_end - stub->target_start, text, text_length)) {
+            stub->target_end = stub->target_start + text_length;
+        }
+
+        return text_length;
+    }
+    case SCI_INSERTTEXT: {
+        const gchar *text = (const gchar *)lParam;
+
+        sci_stub_replace(stub, w < 0 ? stub->current_pos : w, 0, text, strlen(text));
+        return 0;
+    }
+    case SCI_DELETERANGE:
+        sci_stub_replace(stub, w, l, "", 0);
+        return 0;
+    case SCI_SETREADONLY:
+        stub->read_only = w != 0;
+        return 0;
+    case SCI_BEGINUNDOACTION:
+        sci_stub_begin_undo_action(stub);
+        return 0;
+    case SCI_ENDUNDOACTION:
+        stub->undo_depth = MAX(stub->undo_depth - 1, 0);
+        return 0;
+    case SCI_UNDO:
+        sci_stub_undo(stub);
+        return 0;
+    case SCI_SETINDICATORCURRENT:
+        stub->indicator_current = w;
+        return 0;
+    case SCI_INDICATORFILLRANGE:
+        stats.indicator_fills++;
+        return 0;
+    case SCI_INDICATORCLEARRANGE:
+        stats.indicator_clears++;
+        return 0;
+    default:
+        return 0;
+    }
+}
+
+static GObject *sci_stub_get_main_window(void) {
+    if (!main_window) {
+        main_window = g_object_new(sci_stub_get_type(), NULL);
+    }
+
+    return main_window;
+}
+
+ScintillaObject *sci_stub_new(const gchar *text) {
+    SciStub *stub = g_object_new(sci_stub_get_type(), NULL);
+
+    g_string_assign(stub->text, text);
+    stub->lines_dirty = TRUE;
+
+    return (ScintillaObject *)stub;
+}
+
+void sci_stub_free(ScintillaObject *sci) {
+    if ((SciStub *)sci == current) {
+        sci_stub_set_current(NULL);
+    }
+
+    g_object_unref(sci);
+}
+
+void sci_stub_set_text(ScintillaObject *sci, const gchar *text) {
+    SciStub *stub = (SciStub *)sci;
+    gint length = stub->text->len;
+
+    g_string_truncate(stub->text, 0);
+    stub->lines_dirty = TRUE;
+    sci_stub_notify_modified(stub, SC_MOD_DELETETEXT, 0, length);
+
+    g_string_assign(stub->text, text);
+    g_ptr_array_set_size(stub->undo_stack, 0);
+    stub->lines_dirty = TRUE;
+    stub->anchor = stub->current_pos = 0;
+    stub->undo_depth = 0;
+    stub->read_only = FALSE;
+    sci_stub_notify_modified(stub, SC_MOD_INSERTTEXT, 0, stub->text->len);
+}
+
+const gchar *sci_stub_get_text(ScintillaObject *sci) { return ((SciStub *)sci)->text->str; }
+
+gint sci_stub_get_length(ScintillaObject *sci) { return ((SciStub *)sci)->text->len; }
+
+void sci_stub_set_view(ScintillaObject *sci, gint first_visible_line, gint lines_on_screen) {
+    SciStub *stub = (SciStub *)sci;
+
+    stub->first_visible_line = CLAMP(first_visible_line, 0, sci_stub_line_count(stub) - 1);
+    stub->lines_on_screen = lines_on_screen;
+    stub->anchor = stub->current_pos = sci_stub_line_start(stub, stub->first_visible_line + lines_on_screen / 2);
+}
+
+void sci_stub_set_current(ScintillaObject *sci) {
+    current = (SciStub *)sci;
+
+    editor.sci = sci;
+    editor.indent_width = 4;
+    editor.document = &document;
+
+    document.is_valid = sci != NULL;
+    document.editor = &editor;
+}
+
+gboolean sci_stub_send_key(ScintillaObject *sci, guint keyval, guint state) {
+    static guint32 time = 0;
+    GdkEventKey event = {0};
+    gboolean handled = FALSE;
+    gboolean release_handled = FALSE;
+
+    event.type = GDK_KEY_PRESS;
+    event.time = ++time;
+    event.keyval = keyval;
+    event.state = state;
+
+    g_signal_emit_by_name(sci, "key-press-event", &event, &handled);
+
+    event.type = GDK_KEY_RELEASE;
+
+    g_signal_emit_by_name(sci, "key-release-event", &event, &release_handled);
+
+    return handled;
+}
+
+GtkCheckMenuItem *sci_stub_get_menu_item(void) {
+    if (!menu_item) {
+        menu_item = g_object_new(sci_stub_get_type(), NULL);
+    }
+
+    return (GtkCheckMenuItem *)menu_item;
+}
+
+GeanyData *sci_stub_get_geany_data(void) {
+    app.configdir = (gchar *)g_get_tmp_dir();
+    main_widgets.window = (GtkWidget *)sci_stub_get_main_window();
+    geany_data_stub.app = &app;
+    geany_data_stub.main_widgets = &main_widgets;
+
+    return &geany_data_stub;
+}
+
+const SciStubStats *sci_stub_get_stats(void) { return &stats; }
+
+void sci_stub_reset_stats(void) { memset(&stats, 0, sizeof(stats)); }
+
+void sci_stub_set_verbose(gboolean value) { verbose = value; }
+
+void sci_stub_set_notify(SciStubNotify callback, gpointer user_data) {
+    notify = callback;
+    notify_data = user_data;
+}
+
+gchar *sci_get_contents_range(ScintillaObject *sci, gint start, gint end) {
+    SciStub *stub = (SciStub *)sci;
+
+    if (end < 0) {
+        end = stub->text->len;
+    }
+
+    g_return_val_if_fail(start >= 0 && start < end && end <= stub->text->len, NULL);
+
+    stats.bytes_copied += end - start;
+
+    return g_strndup(stub->text->str + start, end - start);
+}
+
+GeanyDocument *document_get_current(void) { return current ? &document : NULL; }
+
+gboolean highlighting_is_code_style(gint lexer, gint style) { return TRUE; }
+
+gboolean highlighting_is_comment_style(gint lexer, gint style) { return FALSE; }
+
+gboolean highlighting_is_string_style(gint lexer, gint style) { return FALSE; }
+
+void gtk_check_menu_item_set_active(GtkCheckMenuItem *check_menu_item, gboolean is_active) {}
+
+GtkClipboard *gtk_clipboard_get(GdkAtom selection) { return NULL; }
+
+gchar *gtk_clipboard_wait_for_text(GtkClipboard *clipboard) { return g_strdup(clipboard_text); }
+
+void sci_stub_set_clipboard(const gchar *text) {
+    g_free(clipboard_text);
+    clipboard_text = g_strdup(text);
+}
+
+void ui_set_statusbar(gboolean log, const gchar *format, ...) {
+    if (!verbose) {
+        return;
+    }
+
+    va_list args;
+
+    va_start(args, format);
+    gchar *message = g_strdup_vprintf(format, args);
+    va_end(args);
+
+    g_printerr("statusbar: %s\n", message);
+    g_free(message);
+}
+
+void msgwin_status_add(const gchar *format, ...) {
+    if (!verbose) {
+        return;
+    }
+
+    va_list args;
+
+    va_start(args, format);
+    gchar *message = g_strdup_vprintf(format, args);
+    va_end(args);
+
+    g_printerr("status: %s\n", message);
+    g_free(message);
+}
+
+void msgwin_switch_tab(gint tabnum, gboolean show) {}
+
+gboolean navqueue_goto_line(GeanyDocument *old_doc, GeanyDocument *new_doc, gint line) {
+    if (new_doc && new_doc->editor) {
+        SciStub *stub = (SciStub *)new_doc->editor->sci;
+
+        scintilla_send_message(new_doc->editor->sci, SCI_GOTOPOS, sci_stub_line_start(stub, line - 1), 0);
+    }
+
+    return TRUE;
+}
+
+void dialogs_show_msgbox(GtkMessageType type, const gchar *text, ...) {
+    va_list args;
+
+    va_start(args, text);
+    gchar *message = g_strdup_vprintf(text, args);
+    va_end(args);
+
+    g_printerr("msgbox: %s\n", message);
+    g_free(message);
+}
+
+void utils_open_browser(const gchar *uri) {}
+
+gint utils_mkdir(const gchar *path, gboolean create_parent_dirs) {
+    return g_mkdir_with_parents(path, 0755) == 0 ? 0 : errno;
+}
+
+gint utils_write_file(const gchar *filename, const gchar *text) {
+    return g_file_set_contents(filename, text, -1, NULL) ? 0 : EIO;
+}
+
+gboolean utils_get_setting_boolean(GKeyFile *config, const gchar *section, const gchar *key,
+                                   const gboolean default_value) {
+    if (!g_key_file_has_key(config, section, key, NULL)) {
+        return default_value;
+    }
+
+    return g_key_file_get_boolean(config, section, key, NULL);
+}
+
+gint utils_get_setting_integer(GKeyFile *config, const gchar *section, const gchar *key, const gint default_value) {
+    if (!g_key_file_has_key(config, section, key, NULL)) {
+        return default_value;
+    }
+
+    return g_key_file_get_integer(config, section, key, NULL);
+}
+
+GeanyKeyGroup *plugin_set_key_group(GeanyPlugin *plugin, const gchar *section_name, gsize count,
+                                    GeanyKeyGroupCallback callback) {
+    return NULL;
+}
+
+GeanyKeyBinding *keybindings_set_item_full(GeanyKeyGroup *group, gsize key_id, guint key, GdkModifierType mod,
+                                           const gchar *kf_name, const gchar *label, GtkWidget *menu_item,
+                                           GeanyKeyBindingFunc cb, gpointer pdata, GDestroyNotify destroy_notify) {
+    return NULL;
+}
+
+void plugin_signal_connect(GeanyPlugin *plugin, GObject *object, const gchar *signal_name, gboolean after,
+                           GCallback callback, gpointer user_data) {
+    if (object) {
+        g_signal_connect_data(object, signal_name, callback, user_data, NULL, after ? G_CONNECT_AFTER : 0);
+    }
+}
+
+gboolean geany_plugin_register_full(GeanyPlugin *plugin, gint api_version, gint min_api_version, gint abi_version,
+                                    gpointer data, GDestroyNotify free_func) {
+    plugin_data = data;
+    return TRUE;
+}
+
+gpointer sci_stub_get_plugin_data(void) { return plugin_data; }
@@ -0,0 +1,54 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCI_STUB_H_
+#define SCI_STUB_H_
+
+#include <geanyplugin.h>
+
+typedef struct {
+    guint64 messages;
+    guint64 indicator_fills;
+    guint64 indicator_clears;
+    guint64 bytes_inserted;
+    guint64 bytes_deleted;
+    guint64 bytes_copied;
+    guint64 undo_actions;
+    guint64 rejected_edits;
+} SciStubStats;
+
+typedef void (*SciStubNotify)(ScintillaObject *sci, const SCNotification *nt, gpointer user_data);
+
+ScintillaObject *sci_stub_new(const gchar *text);
+void sci_stub_free(ScintillaObject *sci);
+void sci_stub_set_text(ScintillaObject *sci, const gchar *text);
+const gchar *sci_stub_get_text(ScintillaObject *sci);
+gint sci_stub_get_length(ScintillaObject *sci);
+void sci_stub_set_view(ScintillaObject *sci, gint first_visible_line, gint lines_on_screen);
+void sci_stub_set_current(ScintillaObject *sci);
+gboolean sci_stub_send_key(ScintillaObject *sci, guint keyval, guint state);
+void sci_stub_set_clipboard(const gchar *text);
+GtkCheckMenuItem *sci_stub_get_menu_item(void);
+GeanyData *sci_stub_get_geany_data(void);
+gpointer sci_stub_get_plugin_data(void);
+const SciStubStats *sci_stub_get_stats(void);
+void sci_stub_reset_stats(void);
+void sci_stub_set_verbose(gboolean verbose);
+void sci_stub_set_notify(SciStubNotify notify, gpointer user_data);
+
+#endif
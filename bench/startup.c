@@ -0,0 +1,122 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+
+#include <plugindata.h>
+
+#include "harness.h"
+#include "sci_stub.h"
+#include "startup.h"
+
+/*
+ * Loads, initializes and cleans up the plugin the way Geany does at startup and shutdown. The menu and keybinding
+ * setup builds real widgets, so unlike the other suites this one needs a display (xvfb-run is enough).
+ */
+
+typedef enum {
+    STARTUP_LOAD,
+    STARTUP_INIT,
+    STARTUP_CLEANUP,
+    STARTUP_TOTAL,
+    STARTUP_PHASE_COUNT,
+} StartupPhase;
+
+static const gchar *phase_names[STARTUP_PHASE_COUNT] = {
+    "geany_load_module",
+    "init",
+    "cleanup",
+    "load + init",
+};
+
+static void startup_once(GeanyData *geany_data, GArray **samples) {
+    PluginInfo info = {0};
+    GeanyPluginFuncs funcs = {0};
+    GeanyPlugin plugin = {0};
+    gint64 elapsed[STARTUP_PHASE_COUNT];
+
+    plugin.info = &info;
+    plugin.funcs = &funcs;
+    plugin.geany_data = geany_data;
+    geany_data->main_widgets->tools_menu = gtk_menu_new();
+    g_object_ref_sink(geany_data->main_widgets->tools_menu);
+
+    gint64 start = g_get_monotonic_time();
+    geany_load_module(&plugin);
+    gint64 loaded = g_get_monotonic_time();
+    plugin.funcs->init(&plugin, sci_stub_get_plugin_data());
+    gint64 initialized = g_get_monotonic_time();
+    plugin.funcs->cleanup(&plugin, sci_stub_get_plugin_data());
+    gint64 cleaned_up = g_get_monotonic_time();
+
+    gtk_widget_destroy(geany_data->main_widgets->tools_menu);
+    g_object_unref(geany_data->main_widgets->tools_menu);
+    geany_data->main_widgets->tools_menu = NULL;
+
+    elapsed[STARTUP_LOAD] = loaded - start;
+    elapsed[STARTUP_INIT] = initialized - loaded;
+    elapsed[STARTUP_CLEANUP] = cleaned_up - initialized;
+    elapsed[STARTUP_TOTAL] = initialized - start;
+
+    if (samples) {
+        for (gint i = 0; i < STARTUP_PHASE_COUNT; i++) {
+            g_array_append_val(samples[i], elapsed[i]);
+        }
+    }
+}
+
+gboolean startup_run(const StartupOptions *options, GError **error) {
+    if (!gtk_init_check(NULL, NULL)) {
+        g_set_error(error, G_OPTION_ERROR, G_OPTION_ERROR_FAILED, "--startup needs a display, try xvfb-run");
+        return FALSE;
+    }
+
+    GeanyData *geany_data = sci_stub_get_geany_data();
+    GArray *samples[STARTUP_PHASE_COUNT];
+    BenchResult results[STARTUP_PHASE_COUNT];
+
+    for (gint i = 0; i < STARTUP_PHASE_COUNT; i++) {
+        samples[i] = g_array_new(FALSE, FALSE, sizeof(gint64));
+    }
+
+    startup_once(geany_data, NULL);
+
+    for (gint i = 0; i < options->iterations; i++) {
+        startup_once(geany_data, samples);
+    }
+
+    printf("%d iterations\n\n", options->iterations);
+    printf("%-34s %10s %10s %10s %10s\n", "startup", "min us", "median us", "mean us", "max us");
+
+    for (gint i = 0; i < STARTUP_PHASE_COUNT; i++) {
+        bench_summarize(samples[i], &results[i]);
+        g_array_free(samples[i], TRUE);
+
+        printf("%-34s %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT " %10" G_GINT64_FORMAT "\n",
+               phase_names[i], results[i].min, results[i].median, results[i].mean, results[i].max);
+    }
+
+    if (options->budget > 0 && results[STARTUP_TOTAL].median > options->budget) {
+        g_set_error(error, G_OPTION_ERROR, G_OPTION_ERROR_FAILED,
+                    "Median load + init took %" G_GINT64_FORMAT " us, over the %d us budget",
+                    results[STARTUP_TOTAL].median, options->budget);
+        return FALSE;
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,210 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+#include <string.h>
+
+#include "alloc_stats.h"
+
+#ifdef ALLOC_STATS
+
+/*
+ * Tracks the GStrings and extracted ranges the plugin allocates, keyed by the file:line that allocated them. Each
+ * record remembers the activation it was made in, so a report can list what the current activation left behind and
+ * how much is still live over the whole session. The parenthesized calls below bypass the wrapper macros.
+ */
+
+typedef struct {
+    const gchar *site;
+    gsize bytes;
+    guint activation;
+} AllocRecord;
+
+typedef struct {
+    const gchar *site;
+    guint allocs;
+    gsize bytes;
+    guint live;
+    gsize live_bytes;
+} SiteStats;
+
+static GHashTable *live = NULL;
+static GHashTable *sites = NULL;
+static guint activation = 0;
+
+static void alloc_stats_track(gpointer mem, gsize bytes, const gchar *site) {
+    if (!mem) {
+        return;
+    }
+
+    if (!live) {
+        live = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, (g_free));
+        sites = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, (g_free));
+    }
+
+    SiteStats *stats = g_hash_table_lookup(sites, site);
+
+    if (!stats) {
+        stats = g_new0(SiteStats, 1);
+        stats->site = site;
+        g_hash_table_insert(sites, (gpointer)site, stats);
+    }
+
+    stats->allocs++;
+    stats->bytes += bytes;
+
+    AllocRecord *record = g_new(AllocRecord, 1);
+
+    record->site = site;
+    record->bytes = bytes;
+    record->activation = activation;
+
+    g_hash_table_replace(live, mem, record);
+}
+
+static void alloc_stats_untrack(gpointer mem) {
+    if (live && mem) {
+        g_hash_table_remove(live, mem);
+    }
+}
+
+GString *alloc_stats_string_new(const gchar *init, const gchar *site) {
+    GString *string = (g_string_new)(init);
+
+    alloc_stats_track(string, sizeof(GString) + string->allocated_len, site);
+
+    return string;
+}
+
+GString *alloc_stats_string_new_len(const gchar *init, gssize len, const gchar *site) {
+    GString *string = (g_string_new_len)(init, len);
+
+    alloc_stats_track(string, sizeof(GString) + string->allocated_len, site);
+
+    return string;
+}
+
+gchar *alloc_stats_string_free(GString *string, gboolean free_segment) {
+    alloc_stats_untrack(string);
+
+    return (g_string_free)(string, free_segment);
+}
+
+void alloc_stats_free(gpointer mem) {
+    alloc_stats_untrack(mem);
+    (g_free)(mem);
+}
+
+gchar *alloc_stats_contents_range(ScintillaObject *sci, gint start, gint end, const gchar *site) {
+#ifdef SCI_STATS
+    gchar *text = sci_stats_get_contents_range(sci, start, end);
+#else
+    gchar *text = (sci_get_contents_range)(sci, start, end);
+#endif
+
+    alloc_stats_track(text, text ? strlen(text) + 1 : 0, site);
+
+    return text;
+}
+
+void alloc_stats_begin_activation(void) {
+    activation++;
+
+    if (sites) {
+        g_hash_table_remove_all(sites);
+    }
+}
+
+static gint alloc_stats_sort_by_bytes(gconstpointer a, gconstpointer b) {
+    const SiteStats *stats_a = *(const SiteStats **)a;
+    const SiteStats *stats_b = *(const SiteStats **)b;
+
+    if (stats_a->live_bytes != stats_b->live_bytes) {
+        return stats_a->live_bytes < stats_b->live_bytes ? 1 : -1;
+    }
+
+    if (stats_a->bytes != stats_b->bytes) {
+        return stats_a->bytes < stats_b->bytes ? 1 : -1;
+    }
+
+    return g_strcmp0(stats_a->site, stats_b->site);
+}
+
+void alloc_stats_report(const gchar *where) {
+    if (!live) {
+        return;
+    }
+
+    GHashTableIter iter;
+    gpointer value;
+    GPtrArray *sorted = g_ptr_array_new();
+    guint allocs = 0;
+    gsize bytes = 0;
+    guint activation_live = 0;
+    gsize activation_live_bytes = 0;
+    guint session_live = 0;
+    gsize session_live_bytes = 0;
+
+    g_hash_table_iter_init(&iter, sites);
+
+    while (g_hash_table_iter_next(&iter, NULL, &value)) {
+        SiteStats *stats = (SiteStats *)value;
+
+        stats->live = 0;
+        stats->live_bytes = 0;
+        allocs += stats->allocs;
+        bytes += stats->bytes;
+        g_ptr_array_add(sorted, stats);
+    }
+
+    g_hash_table_iter_init(&iter, live);
+
+    while (g_hash_table_iter_next(&iter, NULL, &value)) {
+        const AllocRecord *record = (const AllocRecord *)value;
+
+        session_live++;
+        session_live_bytes += record->bytes;
+
+        if (record->activation == activation) {
+            SiteStats *stats = g_hash_table_lookup(sites, record->site);
+
+            stats->live++;
+            stats->live_bytes += record->bytes;
+            activation_live++;
+            activation_live_bytes += record->bytes;
+        }
+    }
+
+    msgwin_status_add(_("%s: %u allocations (%lu bytes) this activation, %u still live (%lu bytes); %u live "
+                        "(%lu bytes) in the session."),
+                      where, allocs, (gulong)bytes, activation_live, (gulong)activation_live_bytes, session_live,
+                      (gulong)session_live_bytes);
+
+    g_ptr_array_sort(sorted, alloc_stats_sort_by_bytes);
+
+    for (gint i = 0; i < sorted->len; i++) {
+        const SiteStats *stats = g_ptr_array_index(sorted, i);
+
+        g_debug("%s: %s %u allocations (%lu bytes), %u live (%lu bytes)", where, stats->site, stats->allocs,
+                (gulong)stats->bytes, stats->live, (gulong)stats->live_bytes);
+    }
+
+    g_ptr_array_free(sorted, TRUE);
+}
+
+#endif
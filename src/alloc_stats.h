@@ -0,0 +1,55 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef ALLOC_STATS_H_
+#define ALLOC_STATS_H_
+
+#include <geanyplugin.h>
+
+#include "sci_stats.h"
+
+#ifdef ALLOC_STATS
+
+#undef g_string_new
+#undef g_string_new_len
+#undef g_string_free
+#undef g_free
+#undef sci_get_contents_range
+
+#define g_string_new(init) alloc_stats_string_new(init, G_STRLOC)
+#define g_string_new_len(init, len) alloc_stats_string_new_len(init, len, G_STRLOC)
+#define g_string_free(string, free_segment) alloc_stats_string_free(string, free_segment)
+#define g_free(mem) alloc_stats_free(mem)
+#define sci_get_contents_range(sci, start, end) alloc_stats_contents_range(sci, start, end, G_STRLOC)
+
+GString *alloc_stats_string_new(const gchar *init, const gchar *site);
+GString *alloc_stats_string_new_len(const gchar *init, gssize len, const gchar *site);
+gchar *alloc_stats_string_free(GString *string, gboolean free_segment);
+void alloc_stats_free(gpointer mem);
+gchar *alloc_stats_contents_range(ScintillaObject *sci, gint start, gint end, const gchar *site);
+void alloc_stats_begin_activation(void);
+void alloc_stats_report(const gchar *where);
+
+#else
+
+#define alloc_stats_begin_activation()
+#define alloc_stats_report(where)
+
+#endif
+
+#endif
@@ -19,7 +19,9 @@
 #include <plugindata.h>
 
 #include "jump_to_a_word.h"
+#include "trace.h"
 #include "util.h"
+#include "values.h"
 
 void annotation_clear(ScintillaObject *sci, gint eol_message_line) {
     scintilla_send_message(sci, SCI_EOLANNOTATIONSETTEXT, eol_message_line, (sptr_t) "");
@@ -28,14 +30,16 @@ void annotation_clear(ScintillaObject *sci, gint eol_message_line) {
 }
 
 void annotation_show(ShortcutJump *sj) {
-    sj->eol_message_line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, sj->current_cursor_pos, 0);
+    gint64 trace_start = trace_now();
+
+    sj->eol_message_line = get_line_from_position(sj, sj->current_cursor_pos);
 
     if (sj->lf_positions && sj->lf_positions->len > 0) {
         gint pos = scintilla_send_message(sj->sci, SCI_GETCURRENTPOS, 0, 0);
-        gint current_line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, pos, 0);
+        gint current_line = get_line_from_position(sj, pos);
         gint lfs_added = get_lfs(sj, current_line);
         gint line = sj->current_cursor_pos + lfs_added;
-        sj->eol_message_line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, line, 0);
+        sj->eol_message_line = get_line_from_position(sj, line);
     }
 
     gint text_color = sj->config_settings->text_color;
@@ -46,6 +50,8 @@ void annotation_show(ShortcutJump *sj) {
     scintilla_send_message(sj->sci, SCI_STYLESETBACK, EOLANNOTATION_STADIUM, search_annotation_bg_color);
     scintilla_send_message(sj->sci, SCI_EOLANNOTATIONSETTEXT, line, (sptr_t)sj->eol_message->str);
     scintilla_send_message(sj->sci, SCI_EOLANNOTATIONSETSTYLEOFFSET, EOLANNOTATION_STADIUM, 0);
+
+    trace_record(TRACE_ANNOTATION, trace_start);
 }
 
 void annotation_display_search(ShortcutJump *sj) {
@@ -0,0 +1,52 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "label.h"
+
+/*
+ * Labels are bijective base 26: a-z, then aa-zz and so on. Without single characters the first 26 are skipped so
+ * every label is at least two characters long.
+ */
+gint label_format(gchar buffer[LABEL_MAX_LENGTH], gboolean include_single_char, gboolean all_caps, gint position) {
+    if (!include_single_char) {
+        position += 26;
+    }
+
+    if (position < 0) {
+        return 0;
+    }
+
+    gint length = 1;
+
+    for (gint temp = position; temp >= 26; temp = temp / 26 - 1) {
+        length++;
+    }
+
+    if (length >= LABEL_MAX_LENGTH) {
+        return 0;
+    }
+
+    for (gint i = length - 1; i >= 0; i--) {
+        buffer[i] = (all_caps ? 'A' : 'a') + position % 26;
+        position = position / 26 - 1;
+    }
+
+    buffer[length] = '\0';
+
+    return length;
+}
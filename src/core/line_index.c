@@ -0,0 +1,70 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "line_index.h"
+
+/*
+ * The line index holds the offset at which every line of a text starts, so the line of any offset in that text is a
+ * binary search instead of a message to Scintilla. Text without a carriage return is split with memchr, which libc
+ * vectorizes; otherwise lone '\r' line ends are found with a byte scan.
+ */
+
+void line_index_build(GArray *starts, const gchar *text, gint length) {
+    gint start = 0;
+
+    g_array_set_size(starts, 0);
+    g_array_append_val(starts, start);
+
+    if (!memchr(text, '\r', length)) {
+        const gchar *end = text + length;
+
+        for (const gchar *p = memchr(text, '\n', length); p; p = memchr(p, '\n', end - p)) {
+            p++;
+            start = p - text;
+            g_array_append_val(starts, start);
+        }
+
+        return;
+    }
+
+    for (gint i = 0; i < length; i++) {
+        if (text[i] == '\n' || (text[i] == '\r' && (i + 1 == length || text[i + 1] != '\n'))) {
+            start = i + 1;
+            g_array_append_val(starts, start);
+        }
+    }
+}
+
+gint line_index_lookup(const GArray *starts, gint offset) {
+    gint low = 0;
+    gint high = starts->len - 1;
+
+    while (low < high) {
+        gint middle = low + (high - low + 1) / 2;
+
+        if (g_array_index(starts, gint, middle) <= offset) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    return low;
+}
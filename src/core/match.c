@@ -0,0 +1,115 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "match.h"
+
+gboolean match_smart_case(gchar haystack_char, gchar needle_char) {
+    gboolean g1 = g_unichar_islower(haystack_char) && g_unichar_islower(needle_char) && needle_char == haystack_char;
+    gboolean g2 = g_unichar_isupper(haystack_char) && g_unichar_islower(needle_char) &&
+                  g_ascii_tolower(haystack_char) == needle_char;
+    gboolean g3 = g_unichar_isupper(haystack_char) && g_unichar_isupper(needle_char) && needle_char == haystack_char;
+    return g1 || g2 || g3 || haystack_char == needle_char;
+}
+
+static gint match_smart_case_run(const gchar *haystack, gint length, const gchar *query, gint query_length) {
+    gint k = 0;
+
+    while (k < length && k < query_length && match_smart_case(haystack[k], query[k])) {
+        k++;
+    }
+
+    return k;
+}
+
+static gboolean match_has_prefix(const gchar *word, gint word_length, const gchar *query, gint query_length) {
+    return word_length >= query_length && memcmp(word, query, query_length) == 0;
+}
+
+static gboolean match_has_prefix_caseless(const gchar *word, gint word_length, const gchar *query,
+                                          gint query_length) {
+    return word_length >= query_length && g_ascii_strncasecmp(word, query, query_length) == 0;
+}
+
+static gint match_find(const gchar *haystack, gint length, gint from, const gchar *query, gint query_length,
+                       gboolean case_sensitive) {
+    for (gint i = from; i + query_length <= length; i++) {
+        if (case_sensitive ? memcmp(haystack + i, query, query_length) == 0
+                           : g_ascii_strncasecmp(haystack + i, query, query_length) == 0) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+gboolean match_word(const gchar *word, gint word_length, const gchar *query, gint query_length,
+                    const MatchOptions *options) {
+    if (options->whole_word) {
+        return word_length == query_length && memcmp(word, query, query_length) == 0;
+    }
+
+    if (options->case_sensitive && options->smart_case) {
+        if (options->from_beginning) {
+            return word_length >= query_length &&
+                   match_smart_case_run(word, word_length, query, query_length) == query_length;
+        }
+
+        for (gint i = 0; i < word_length; i++) {
+            if (match_smart_case_run(word + i, word_length - i, query, query_length) >= 1) {
+                return TRUE;
+            }
+        }
+
+        return FALSE;
+    }
+
+    if (options->from_beginning) {
+        return options->case_sensitive ? match_has_prefix(word, word_length, query, query_length)
+                                       : match_has_prefix_caseless(word, word_length, query, query_length);
+    }
+
+    return match_find(word, word_length, 0, query, query_length, options->case_sensitive) != -1;
+}
+
+/*
+ * Appends the offset of every match of query in haystack. Smart case matches may overlap, the exact and caseless
+ * searches resume after each match.
+ */
+void match_substrings(const gchar *haystack, gint length, const gchar *query, gint query_length,
+                      const MatchOptions *options, GArray *positions) {
+    if (query_length == 0) {
+        return;
+    }
+
+    if (options->case_sensitive && options->smart_case) {
+        for (gint i = 0; i + query_length <= length; i++) {
+            if (match_smart_case_run(haystack + i, length - i, query, query_length) == query_length) {
+                g_array_append_val(positions, i);
+            }
+        }
+
+        return;
+    }
+
+    for (gint i = match_find(haystack, length, 0, query, query_length, options->case_sensitive); i != -1;
+         i = match_find(haystack, length, i + query_length, query, query_length, options->case_sensitive)) {
+        g_array_append_val(positions, i);
+    }
+}
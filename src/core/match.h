@@ -0,0 +1,37 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef MATCH_H_
+#define MATCH_H_
+
+#include <glib.h>
+
+typedef struct {
+    gboolean whole_word;
+    gboolean case_sensitive;
+    gboolean smart_case;
+    gboolean from_beginning;
+} MatchOptions;
+
+gboolean match_smart_case(gchar haystack_char, gchar needle_char);
+gboolean match_word(const gchar *word, gint word_length, const gchar *query, gint query_length,
+                    const MatchOptions *options);
+void match_substrings(const gchar *haystack, gint length, const gchar *query, gint query_length,
+                      const MatchOptions *options, GArray *positions);
+
+#endif
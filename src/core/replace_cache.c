@@ -0,0 +1,104 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "replace_cache.h"
+
+/*
+ * The replace cache holds the text between the first and last match with every match at span.position. Each edit
+ * applies the same change at every match in one pass over the cache and moves the spans to where their matches end
+ * up, instead of inserting into or erasing from the cache once per match.
+ */
+
+void replace_cache_insert(GString *cache, GArray *spans, gint offset, const gchar *text, gint length) {
+    GString *result = g_string_sized_new(cache->len + spans->len * length);
+    gint copied = 0;
+
+    for (gint i = 0; i < spans->len; i++) {
+        Span *span = &g_array_index(spans, Span, i);
+        gint at = CLAMP(span->position + offset, copied, (gint)cache->len);
+
+        g_string_append_len(result, cache->str + copied, at - copied);
+        g_string_append_len(result, text, length);
+        copied = at;
+        span->position += i * length;
+    }
+
+    g_string_append_len(result, cache->str + copied, cache->len - copied);
+    g_string_truncate(cache, 0);
+    g_string_append_len(cache, result->str, result->len);
+    g_string_free(result, TRUE);
+}
+
+/*
+ * Erases length bytes at offset from every match. Nothing is changed when the last match has fewer than length bytes
+ * left after offset.
+ */
+gboolean replace_cache_erase(GString *cache, GArray *spans, gint offset, gint length) {
+    if (spans->len == 0) {
+        return TRUE;
+    }
+
+    Span last = g_array_index(spans, Span, spans->len - 1);
+
+    if (last.position + offset + length > cache->len) {
+        return FALSE;
+    }
+
+    gint removed = 0;
+    gint write = 0;
+    gint read = 0;
+
+    for (gint i = 0; i < spans->len; i++) {
+        Span *span = &g_array_index(spans, Span, i);
+        gint at = CLAMP(span->position + offset, read, (gint)cache->len);
+
+        memmove(cache->str + write, cache->str + read, at - read);
+        write += at - read;
+        read = MIN(at + length, (gint)cache->len);
+        span->position -= removed;
+        removed += length;
+    }
+
+    memmove(cache->str + write, cache->str + read, cache->len - read);
+    g_string_truncate(cache, write + cache->len - read);
+
+    return TRUE;
+}
+
+void replace_cache_erase_spans(GString *cache, GArray *spans) {
+    gint removed = 0;
+    gint write = 0;
+    gint read = 0;
+
+    for (gint i = 0; i < spans->len; i++) {
+        Span *span = &g_array_index(spans, Span, i);
+        gint at = CLAMP(span->position, read, (gint)cache->len);
+        gint end = CLAMP(span->position + span->length, at, (gint)cache->len);
+
+        memmove(cache->str + write, cache->str + read, at - read);
+        write += at - read;
+        read = end;
+        span->position -= removed;
+        removed += end - at;
+    }
+
+    memmove(cache->str + write, cache->str + read, cache->len - read);
+    g_string_truncate(cache, write + cache->len - read);
+}
@@ -0,0 +1,30 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef REPLACE_CACHE_H_
+#define REPLACE_CACHE_H_
+
+#include <glib.h>
+
+#include "span.h"
+
+void replace_cache_insert(GString *cache, GArray *spans, gint offset, const gchar *text, gint length);
+gboolean replace_cache_erase(GString *cache, GArray *spans, gint offset, gint length);
+void replace_cache_erase_spans(GString *cache, GArray *spans);
+
+#endif
@@ -0,0 +1,246 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "tokenizer.h"
+#include "utf8_scan.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define TOKENIZER_X86
+#endif
+
+#define TOKENIZER_BLOCK 32
+
+typedef guint32 (*TokenizerClassify)(const guchar *bytes, const WordChars *word_chars);
+
+/*
+ * Scintilla treats the characters in SCI_GETWORDCHARS as word characters, and classes the rest of Unicode by
+ * category. Every byte above 0x7F is marked here so the block classifiers keep multibyte characters in their runs,
+ * and the runs that hold any are split by category afterwards.
+ */
+void tokenizer_set_word_chars(WordChars *word_chars, const gchar *chars) {
+    for (gint ch = 0; ch < 256; ch++) {
+        word_chars->word[ch] = ch >= 0x80;
+    }
+
+    memset(word_chars->low_nibbles, 0, sizeof(word_chars->low_nibbles));
+
+    for (const guchar *p = (const guchar *)chars; *p != '\0'; p++) {
+        word_chars->word[*p] = TRUE;
+
+        if (*p < 0x80) {
+            word_chars->low_nibbles[*p & 0x0f] |= 1 << (*p >> 4);
+        }
+    }
+}
+
+/*
+ * A classifier returns a mask with bit k set when bytes[k] is a word character, for a block of TOKENIZER_BLOCK
+ * bytes. The vector versions look the low nibble of each byte up in low_nibbles and test the bit of its high
+ * nibble; pshufb gives zero for bytes above 0x7F, which are word characters by their sign bit instead.
+ */
+static guint32 tokenizer_classify_scalar(const guchar *bytes, const WordChars *word_chars) {
+    guint32 mask = 0;
+
+    for (gint k = 0; k < TOKENIZER_BLOCK; k++) {
+        mask |= (guint32)word_chars->word[bytes[k]] << k;
+    }
+
+    return mask;
+}
+
+#ifdef TOKENIZER_X86
+__attribute__((target("ssse3"))) static guint32 tokenizer_classify_ssse3(const guchar *bytes,
+                                                                         const WordChars *word_chars) {
+    const __m128i nibbles = _mm_loadu_si128((const __m128i *)word_chars->low_nibbles);
+    const __m128i high_bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i low_mask = _mm_set1_epi8(0x0f);
+    guint32 mask = 0;
+
+    for (gint k = 0; k < TOKENIZER_BLOCK; k += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(bytes + k));
+        __m128i rows = _mm_shuffle_epi8(nibbles, v);
+        __m128i bit = _mm_shuffle_epi8(high_bits, _mm_and_si128(_mm_srli_epi16(v, 4), low_mask));
+        __m128i ascii = _mm_cmpeq_epi8(_mm_and_si128(rows, bit), _mm_setzero_si128());
+
+        mask |= ((guint32)(~_mm_movemask_epi8(ascii) | _mm_movemask_epi8(v)) & 0xffff) << k;
+    }
+
+    return mask;
+}
+
+__attribute__((target("avx2"))) static guint32 tokenizer_classify_avx2(const guchar *bytes,
+                                                                       const WordChars *word_chars) {
+    const __m256i nibbles = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)word_chars->low_nibbles));
+    const __m256i high_bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16,
+                                               32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    __m256i v = _mm256_loadu_si256((const __m256i *)bytes);
+    __m256i rows = _mm256_shuffle_epi8(nibbles, v);
+    __m256i bit = _mm256_shuffle_epi8(high_bits, _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f)));
+    __m256i ascii = _mm256_cmpeq_epi8(_mm256_and_si256(rows, bit), _mm256_setzero_si256());
+
+    return ~(guint32)_mm256_movemask_epi8(ascii) | (guint32)_mm256_movemask_epi8(v);
+}
+#endif
+
+static TokenizerClassify tokenizer_get_classify(void) {
+    static gsize classify = 0;
+
+    if (g_once_init_enter(&classify)) {
+        TokenizerClassify selected = tokenizer_classify_scalar;
+
+#ifdef TOKENIZER_X86
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2")) {
+            selected = tokenizer_classify_avx2;
+        } else if (__builtin_cpu_supports("ssse3")) {
+            selected = tokenizer_classify_ssse3;
+        }
+#endif
+
+        g_once_init_leave(&classify, (gsize)selected);
+    }
+
+    return (TokenizerClassify)classify;
+}
+
+gboolean tokenizer_is_word_char(const WordChars *word_chars, gunichar ch) {
+    return ch < 0x80 ? word_chars->word[ch] : utf8_scan_is_word_char(ch);
+}
+
+/*
+ * A run of pure ASCII is a word as it is. A run with multibyte characters in it is decoded and split wherever a
+ * character outside the word categories, such as a non-breaking space or a dash, sits inside it.
+ */
+static void tokenizer_append(const gchar *text, Span span, GArray *spans) {
+    if (utf8_scan_is_ascii(text + span.position, span.length)) {
+        g_array_append_val(spans, span);
+        return;
+    }
+
+    gint end = span.position + span.length;
+    Span word = {-1, 0};
+
+    for (gint i = span.position; i < end;) {
+        gint width;
+        gunichar ch = utf8_scan_decode(text + i, end - i, &width);
+        gboolean is_word = ch < 0x80 || utf8_scan_is_word_char(ch);
+
+        if (is_word && word.position < 0) {
+            word.position = i;
+        } else if (!is_word && word.position >= 0) {
+            word.length = i - word.position;
+            g_array_append_val(spans, word);
+            word.position = -1;
+        }
+
+        i += width;
+    }
+
+    if (word.position >= 0) {
+        word.length = end - word.position;
+        g_array_append_val(spans, word);
+    }
+}
+
+/*
+ * Words are found a block at a time: the block is classified into a mask, and every bit where the class differs
+ * from the byte before it starts or ends a word.
+ */
+static void tokenizer_scan_blocks(TokenizerClassify classify, const gchar *text, gint length,
+                                  const WordChars *word_chars, GArray *spans) {
+    const guchar *bytes = (const guchar *)text;
+    guchar tail[TOKENIZER_BLOCK];
+    guint32 in_word = 0;
+    Span span = {0, 0};
+
+    for (gint i = 0; i < length; i += TOKENIZER_BLOCK) {
+        gint n = MIN(length - i, TOKENIZER_BLOCK);
+        guint32 mask;
+
+        if (n == TOKENIZER_BLOCK) {
+            mask = classify(bytes + i, word_chars);
+        } else {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, bytes + i, n);
+            mask = classify(tail, word_chars) & ((1u << n) - 1);
+        }
+
+        guint32 edges = mask ^ ((mask << 1) | in_word);
+
+        while (edges) {
+            gint k = g_bit_nth_lsf(edges, -1);
+
+            if (in_word) {
+                span.length = i + k - span.position;
+                tokenizer_append(text, span, spans);
+            } else {
+                span.position = i + k;
+            }
+
+            in_word ^= 1;
+            edges &= edges - 1;
+        }
+    }
+
+    if (in_word) {
+        span.length = length - span.position;
+        tokenizer_append(text, span, spans);
+    }
+}
+
+void tokenizer_scan(const gchar *text, gint length, const WordChars *word_chars, GArray *spans) {
+    tokenizer_scan_blocks(tokenizer_get_classify(), text, length, word_chars, spans);
+}
+
+/*
+ * Scans with a given classifier instead of the one picked for the CPU, so the tests can check that the vector
+ * classifiers agree with the scalar one. Returns FALSE when the CPU cannot run it.
+ */
+gboolean tokenizer_scan_with(TokenizerPath path, const gchar *text, gint length, const WordChars *word_chars,
+                             GArray *spans) {
+    TokenizerClassify classify = NULL;
+
+    switch (path) {
+    case TOKENIZER_SCALAR:
+        classify = tokenizer_classify_scalar;
+        break;
+#ifdef TOKENIZER_X86
+    case TOKENIZER_SSSE3:
+        __builtin_cpu_init();
+        classify = __builtin_cpu_supports("ssse3") ? tokenizer_classify_ssse3 : NULL;
+        break;
+    case TOKENIZER_AVX2:
+        __builtin_cpu_init();
+        classify = __builtin_cpu_supports("avx2") ? tokenizer_classify_avx2 : NULL;
+        break;
+#endif
+    default:
+        break;
+    }
+
+    if (!classify) {
+        return FALSE;
+    }
+
+    tokenizer_scan_blocks(classify, text, length, word_chars, spans);
+    return TRUE;
+}
@@ -0,0 +1,44 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TOKENIZER_H_
+#define TOKENIZER_H_
+
+#include <glib.h>
+
+#include "span.h"
+
+/* low_nibbles[n] has bit h set when the ASCII byte 0xhn is a word character, for the vector classifiers */
+typedef struct {
+    gboolean word[256];
+    guint8 low_nibbles[16];
+} WordChars;
+
+typedef enum {
+    TOKENIZER_SCALAR,
+    TOKENIZER_SSSE3,
+    TOKENIZER_AVX2,
+} TokenizerPath;
+
+void tokenizer_set_word_chars(WordChars *word_chars, const gchar *chars);
+gboolean tokenizer_is_word_char(const WordChars *word_chars, gunichar ch);
+void tokenizer_scan(const gchar *text, gint length, const WordChars *word_chars, GArray *spans);
+gboolean tokenizer_scan_with(TokenizerPath path, const gchar *text, gint length, const WordChars *word_chars,
+                             GArray *spans);
+
+#endif
@@ -0,0 +1,162 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "utf8_scan.h"
+
+#define UTF8_SCAN_BLOCK 16
+#define UTF8_SCAN_HIGH_BITS G_GUINT64_CONSTANT(0x8080808080808080)
+
+/* Whether no byte of the text is above 0x7F, tested sixteen bytes at a time */
+gboolean utf8_scan_is_ascii(const gchar *text, gint length) {
+    gint i = 0;
+
+    for (; i + UTF8_SCAN_BLOCK <= length; i += UTF8_SCAN_BLOCK) {
+        guint64 low, high;
+
+        memcpy(&low, text + i, sizeof(low));
+        memcpy(&high, text + i + sizeof(low), sizeof(high));
+
+        if ((low | high) & UTF8_SCAN_HIGH_BITS) {
+            return FALSE;
+        }
+    }
+
+    for (; i < length; i++) {
+        if ((guchar)text[i] >= 0x80) {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/* The bytes in the character a lead byte starts, and 1 for a byte that cannot start one */
+gint utf8_scan_char_length(guchar lead) {
+    if (lead < 0xC2) {
+        return 1;
+    } else if (lead < 0xE0) {
+        return 2;
+    } else if (lead < 0xF0) {
+        return 3;
+    } else if (lead < 0xF5) {
+        return 4;
+    }
+
+    return 1;
+}
+
+/*
+ * The character at the start of text and, through width, the bytes it takes. A malformed or cut off sequence is
+ * read as one U+FFFD byte, the way Scintilla reads it.
+ */
+gunichar utf8_scan_decode(const gchar *text, gint length, gint *width) {
+    guchar lead = text[0];
+
+    *width = 1;
+
+    if (lead < 0x80) {
+        return lead;
+    }
+
+    gint n = utf8_scan_char_length(lead);
+
+    if (n == 1 || n > length) {
+        return 0xFFFD;
+    }
+
+    gunichar ch = g_utf8_get_char_validated(text, n);
+
+    if (ch == (gunichar)-1 || ch == (gunichar)-2) {
+        return 0xFFFD;
+    }
+
+    *width = n;
+    return ch;
+}
+
+/* The start of the character holding the byte at position */
+gint utf8_scan_char_start(const gchar *text, gint position) {
+    while (position > 0 && ((guchar)text[position] & 0xC0) == 0x80) {
+        position--;
+    }
+
+    return position;
+}
+
+/*
+ * Scintilla classes a character above 0x7F by its Unicode category when it looks for words: letters, numbers and
+ * marks belong to words, and spaces, punctuation and symbols separate them.
+ */
+gboolean utf8_scan_is_word_char(gunichar ch) {
+    switch (g_unichar_type(ch)) {
+    case G_UNICODE_LOWERCASE_LETTER:
+    case G_UNICODE_MODIFIER_LETTER:
+    case G_UNICODE_OTHER_LETTER:
+    case G_UNICODE_TITLECASE_LETTER:
+    case G_UNICODE_UPPERCASE_LETTER:
+    case G_UNICODE_DECIMAL_NUMBER:
+    case G_UNICODE_LETTER_NUMBER:
+    case G_UNICODE_OTHER_NUMBER:
+    case G_UNICODE_SPACING_MARK:
+    case G_UNICODE_ENCLOSING_MARK:
+    case G_UNICODE_NON_SPACING_MARK:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/*
+ * Appends the byte offset of every occurrence of a character. An ASCII byte never occurs inside a longer sequence, so
+ * an ASCII query is a plain byte search. Any other query skips blocks of pure ASCII whole and steps through the rest
+ * a character at a time, so it only ever matches at the start of a character.
+ */
+void utf8_scan_find_char(const gchar *text, gint length, gunichar query, GArray *positions) {
+    gchar encoded[6];
+    gint query_length = g_unichar_to_utf8(query, encoded);
+
+    if (query_length == 1) {
+        for (const gchar *p = text; (p = memchr(p, encoded[0], length - (p - text))) != NULL; p++) {
+            gint position = p - text;
+            g_array_append_val(positions, position);
+        }
+
+        return;
+    }
+
+    gint i = 0;
+
+    while (i < length) {
+        if (i + UTF8_SCAN_BLOCK <= length && utf8_scan_is_ascii(text + i, UTF8_SCAN_BLOCK)) {
+            i += UTF8_SCAN_BLOCK;
+            continue;
+        }
+
+        gint width;
+
+        utf8_scan_decode(text + i, length - i, &width);
+
+        if (width == query_length && memcmp(text + i, encoded, query_length) == 0) {
+            g_array_append_val(positions, i);
+        }
+
+        i += width;
+    }
+}
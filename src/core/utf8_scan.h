@@ -0,0 +1,31 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef UTF8_SCAN_H_
+#define UTF8_SCAN_H_
+
+#include <glib.h>
+
+gboolean utf8_scan_is_ascii(const gchar *text, gint length);
+gint utf8_scan_char_length(guchar lead);
+gunichar utf8_scan_decode(const gchar *text, gint length, gint *width);
+gint utf8_scan_char_start(const gchar *text, gint position);
+gboolean utf8_scan_is_word_char(gunichar ch);
+void utf8_scan_find_char(const gchar *text, gint length, gunichar query, GArray *positions);
+
+#endif
@@ -0,0 +1,90 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "word_index.h"
+
+/*
+ * A word index holds the span of every word in a document, in document positions and in order. Words never cross a
+ * line end, so an edit only changes the words of the lines it touches: those are tokenized again and the words after
+ * them are moved by the change in length.
+ */
+
+static gint word_index_find(const GArray *index, gint position) {
+    gint low = 0;
+    gint high = index->len;
+
+    while (low < high) {
+        gint middle = low + (high - low) / 2;
+
+        if (g_array_index(index, Span, middle).position < position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+void word_index_build(GArray *index, const gchar *text, gint length, const WordChars *word_chars) {
+    g_array_set_size(index, 0);
+    tokenizer_scan(text, length, word_chars, index);
+}
+
+/*
+ * The lines from start to old_end before the edit now hold text, which starts at start and is length bytes long.
+ */
+void word_index_replace_lines(GArray *index, gint start, gint old_end, const gchar *text, gint length,
+                              const WordChars *word_chars) {
+    gint first = word_index_find(index, start);
+    gint last = word_index_find(index, old_end + 1);
+    gint shift = start + length - old_end;
+    GArray *words = g_array_new(FALSE, FALSE, sizeof(Span));
+
+    for (gint i = last; i < index->len && shift != 0; i++) {
+        g_array_index(index, Span, i).position += shift;
+    }
+
+    tokenizer_scan(text, length, word_chars, words);
+
+    for (gint i = 0; i < words->len; i++) {
+        g_array_index(words, Span, i).position += start;
+    }
+
+    g_array_remove_range(index, first, last - first);
+    g_array_insert_vals(index, first, words->data, words->len);
+    g_array_free(words, TRUE);
+}
+
+/*
+ * Appends the words that lie wholly between start and end, with positions relative to start.
+ */
+void word_index_get_spans(const GArray *index, gint start, gint end, GArray *spans) {
+    gint first = word_index_find(index, start);
+
+    for (gint i = first; i < index->len; i++) {
+        Span span = g_array_index(index, Span, i);
+
+        if (span.position + span.length > end) {
+            break;
+        }
+
+        span.position -= start;
+        g_array_append_val(spans, span);
+    }
+}
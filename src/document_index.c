@@ -0,0 +1,363 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include <plugindata.h>
+
+#include "core/word_index.h"
+#include "document_index.h"
+#include "search_word.h"
+#include "util.h"
+#include "values.h"
+
+/*
+ * With whole document search on, every document searched keeps an index of its words so an activation reads the
+ * words of its range from the index instead of tokenizing the whole file again. The index is kept current from the
+ * insert and delete notifications by tokenizing only the lines an edit touches, and is dropped when the filetype
+ * changes, the document closes or whole document search is turned off.
+ *
+ * A large document is indexed a batch of lines at a time on a worker thread, which is given a copy of only the batch
+ * it tokenizes and hands the words back to the main loop before the next batch is copied. A word search over the
+ * whole document takes the words found so far and is given each later batch, with its text, as it arrives, so typing
+ * starts at once; anything else that needs the index before it is done finishes it on the spot. An edit made while
+ * the words are being found drops the index.
+ */
+
+#define DOCUMENT_INDEX_ASYNC_LENGTH (1 << 20)
+#define DOCUMENT_INDEX_BATCH_LENGTH (1 << 18)
+
+typedef struct {
+    GArray *words;
+    WordChars word_chars;
+    gint length;
+    GCancellable *build;
+    gint built_length;
+} DocumentIndex;
+
+typedef struct {
+    ShortcutJump *sj;
+    ScintillaObject *sci;
+    gchar *text;
+    gint start;
+    gint end;
+    WordChars word_chars;
+    GArray *words;
+} DocumentIndexBatch;
+
+static void document_index_cancel_build(DocumentIndex *entry) {
+    if (entry->build) {
+        g_cancellable_cancel(entry->build);
+        g_object_unref(entry->build);
+        entry->build = NULL;
+    }
+}
+
+static void document_index_entry_free(gpointer data) {
+    DocumentIndex *entry = (DocumentIndex *)data;
+
+    document_index_cancel_build(entry);
+    g_array_free(entry->words, TRUE);
+    g_free(entry);
+}
+
+/*
+ * The words of an unfinished build go to the index, and to the word search still waiting on them along with the text
+ * they were found in.
+ */
+static void document_index_take_batch(ShortcutJump *sj, ScintillaObject *sci, DocumentIndex *entry, GArray *words,
+                                      gint end) {
+    g_array_append_vals(entry->words, words->data, words->len);
+    entry->built_length = end;
+
+    if (end == entry->length) {
+        document_index_cancel_build(entry);
+    }
+
+    if (sj->document_index_pending && sj->sci == sci) {
+        load_sj_text(sj, end);
+        search_word_add_spans(sj, words);
+        sj->document_index_pending = entry->build != NULL;
+    }
+}
+
+static void document_index_batch_free(gpointer data) {
+    DocumentIndexBatch *batch = (DocumentIndexBatch *)data;
+
+    g_free(batch->text);
+    g_array_free(batch->words, TRUE);
+    g_free(batch);
+}
+
+/* Runs on the worker thread */
+static void document_index_batch_run(GTask *task, gpointer source_object, gpointer task_data,
+                                     GCancellable *cancellable) {
+    DocumentIndexBatch *batch = (DocumentIndexBatch *)task_data;
+
+    tokenizer_scan(batch->text, batch->end - batch->start, &batch->word_chars, batch->words);
+
+    for (gint i = 0; i < batch->words->len; i++) {
+        g_array_index(batch->words, Span, i).position += batch->start;
+    }
+
+    g_task_return_boolean(task, TRUE);
+}
+
+static void document_index_batch_done(GObject *source_object, GAsyncResult *result, gpointer user_data);
+
+/*
+ * Copies the next batch of the document, which ends at a line end as no word crosses one, and tokenizes it on the
+ * worker thread. The document has not changed since the build began, as an edit would have dropped the index.
+ */
+static void document_index_start_batch(ShortcutJump *sj, ScintillaObject *sci, DocumentIndex *entry, gint start) {
+    const gchar *text = (const gchar *)scintilla_send_message(sci, SCI_GETCHARACTERPOINTER, 0, 0);
+    gint end = MIN(start + DOCUMENT_INDEX_BATCH_LENGTH, entry->length);
+    const gchar *line_end = memchr(text + end, '\n', entry->length - end);
+    DocumentIndexBatch *batch = g_new0(DocumentIndexBatch, 1);
+
+    end = line_end ? line_end - text + 1 : entry->length;
+
+    batch->sj = sj;
+    batch->sci = sci;
+    batch->text = g_strndup(text + start, end - start);
+    batch->start = start;
+    batch->end = end;
+    batch->word_chars = entry->word_chars;
+    batch->words = g_array_new(FALSE, FALSE, sizeof(Span));
+
+    GTask *task = g_task_new(NULL, entry->build, document_index_batch_done, NULL);
+
+    g_task_set_task_data(task, batch, document_index_batch_free);
+    g_task_set_priority(task, G_PRIORITY_DEFAULT_IDLE);
+    g_task_run_in_thread(task, document_index_batch_run);
+    g_object_unref(task);
+}
+
+/*
+ * Runs on the main loop once a batch is tokenized. The result of a cancelled build is an error, so a batch of a build
+ * that was dropped or finished on the spot is never used. The next batch is started before this one is taken so the
+ * worker tokenizes it while the search matches the words.
+ */
+static void document_index_batch_done(GObject *source_object, GAsyncResult *result, gpointer user_data) {
+    GTask *task = G_TASK(result);
+    DocumentIndexBatch *batch = (DocumentIndexBatch *)g_task_get_task_data(task);
+
+    if (!g_task_propagate_boolean(task, NULL)) {
+        return;
+    }
+
+    DocumentIndex *entry = g_hash_table_lookup(batch->sj->document_indexes, batch->sci);
+
+    if (batch->end < entry->length) {
+        document_index_start_batch(batch->sj, batch->sci, entry, batch->end);
+    }
+
+    document_index_take_batch(batch->sj, batch->sci, entry, batch->words, batch->end);
+}
+
+/*
+ * Finds the words a build has not handed back yet on the main thread.
+ */
+static void document_index_finish_build(ShortcutJump *sj, ScintillaObject *sci, DocumentIndex *entry) {
+    if (!entry->build) {
+        return;
+    }
+
+    const gchar *text = (const gchar *)scintilla_send_message(sci, SCI_GETCHARACTERPOINTER, 0, 0);
+    GArray *words = g_array_new(FALSE, FALSE, sizeof(Span));
+    gint start = entry->built_length;
+
+    tokenizer_scan(text + start, entry->length - start, &entry->word_chars, words);
+
+    for (gint i = 0; i < words->len; i++) {
+        g_array_index(words, Span, i).position += start;
+    }
+
+    document_index_take_batch(sj, sci, entry, words, entry->length);
+    g_array_free(words, TRUE);
+}
+
+static DocumentIndex *document_index_get(ShortcutJump *sj) {
+    if (!sj->document_indexes) {
+        sj->document_indexes = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, document_index_entry_free);
+    }
+
+    DocumentIndex *entry = g_hash_table_lookup(sj->document_indexes, sj->sci);
+    gint length = scintilla_send_message(sj->sci, SCI_GETLENGTH, 0, 0);
+
+    if (entry && entry->length == length) {
+        return entry;
+    }
+
+    if (!entry) {
+        entry = g_new0(DocumentIndex, 1);
+        entry->words = g_array_new(FALSE, FALSE, sizeof(Span));
+        g_hash_table_insert(sj->document_indexes, sj->sci, entry);
+    }
+
+    const gchar *text = (const gchar *)scintilla_send_message(sj->sci, SCI_GETCHARACTERPOINTER, 0, 0);
+
+    document_index_cancel_build(entry);
+    g_array_set_size(entry->words, 0);
+
+    entry->word_chars = *get_word_chars(sj);
+    entry->length = length;
+    entry->built_length = 0;
+
+    if (length < DOCUMENT_INDEX_ASYNC_LENGTH) {
+        word_index_build(entry->words, text, length, &entry->word_chars);
+        entry->built_length = length;
+    } else {
+        entry->build = g_cancellable_new();
+        document_index_start_batch(sj, sj->sci, entry, 0);
+    }
+
+    return entry;
+}
+
+/*
+ * Whether the words of the activation being set up will be handed to it a batch at a time by a build of the index,
+ * in which case it only needs the text of its range as far as the build has got.
+ */
+gboolean document_index_defers_text(ShortcutJump *sj) {
+    if (!sj->config_settings->whole_document || sj->current_mode != JM_SEARCH) {
+        return FALSE;
+    }
+
+    gint length = scintilla_send_message(sj->sci, SCI_GETLENGTH, 0, 0);
+
+    if (sj->first_position > 0 || sj->last_position < length) {
+        return FALSE;
+    }
+
+    DocumentIndex *entry = sj->document_indexes ? g_hash_table_lookup(sj->document_indexes, sj->sci) : NULL;
+
+    if (entry && entry->length == length) {
+        return entry->build != NULL;
+    }
+
+    return length >= DOCUMENT_INDEX_ASYNC_LENGTH;
+}
+
+/*
+ * Only word searches read the index, as a word jump covers the view alone, which the view cache already serves.
+ * While the index is still being built, a range smaller than the document is left to the caller to tokenize, a word
+ * search over the whole document gets the words so far and waits for the rest, and anything else finishes the build.
+ * The text is only read up to the index when init_sj_values left it to the index, as a repeated action reads its own.
+ */
+gboolean document_index_get_view_spans(ShortcutJump *sj, GArray *spans) {
+    if (!sj->config_settings->whole_document || sj->current_mode == JM_SHORTCUT_WORD) {
+        return FALSE;
+    }
+
+    gboolean deferred = sj->document_index_pending || document_index_defers_text(sj);
+    DocumentIndex *entry = document_index_get(sj);
+
+    if (entry->build) {
+        if (sj->first_position > 0 || sj->last_position < entry->length) {
+            return FALSE;
+        }
+
+        if (sj->current_mode == JM_SEARCH && !sj->replace_instant) {
+            sj->document_index_pending = TRUE;
+        } else {
+            document_index_finish_build(sj, sj->sci, entry);
+        }
+    }
+
+    if (deferred) {
+        load_sj_text(sj, entry->built_length);
+    }
+
+    word_index_get_spans(entry->words, sj->first_position, sj->last_position, spans);
+    return TRUE;
+}
+
+/*
+ * Hands the words a word search is still waiting on to it at once, for when it is about to act on all of them.
+ */
+void document_index_complete(ShortcutJump *sj) {
+    if (!sj->document_index_pending || !sj->document_indexes) {
+        return;
+    }
+
+    DocumentIndex *entry = g_hash_table_lookup(sj->document_indexes, sj->sci);
+
+    if (entry) {
+        document_index_finish_build(sj, sj->sci, entry);
+    }
+
+    sj->document_index_pending = FALSE;
+}
+
+void document_index_update(ShortcutJump *sj, ScintillaObject *sci, const SCNotification *nt) {
+    if (!sj->document_indexes) {
+        return;
+    }
+
+    if (!sj->config_settings->whole_document) {
+        document_index_free(sj);
+        return;
+    }
+
+    DocumentIndex *entry = g_hash_table_lookup(sj->document_indexes, sci);
+
+    if (!entry) {
+        return;
+    }
+
+    /* A build copies the document a batch at a time as it goes, so any edit, tags included, drops it */
+    if (entry->build) {
+        if (sj->document_index_pending && sj->sci == sci) {
+            sj->document_index_pending = FALSE;
+            load_sj_text(sj, sj->last_position);
+        }
+
+        g_hash_table_remove(sj->document_indexes, sci);
+        return;
+    }
+
+    /* Tags written into the document are always undone, so they leave the words of the document as they were */
+    if (sj->placing_tags) {
+        return;
+    }
+
+    gint inserted = nt->modificationType & SC_MOD_INSERTTEXT ? nt->length : 0;
+    gint deleted = nt->modificationType & SC_MOD_DELETETEXT ? nt->length : 0;
+    gint first_line = scintilla_send_message(sci, SCI_LINEFROMPOSITION, nt->position, 0);
+    gint last_line = scintilla_send_message(sci, SCI_LINEFROMPOSITION, nt->position + inserted, 0);
+    gint start = scintilla_send_message(sci, SCI_POSITIONFROMLINE, first_line, 0);
+    gint end = scintilla_send_message(sci, SCI_GETLINEENDPOSITION, last_line, 0);
+    const gchar *text = (const gchar *)scintilla_send_message(sci, SCI_GETRANGEPOINTER, start, end - start);
+
+    word_index_replace_lines(entry->words, start, end - inserted + deleted, text, end - start, &entry->word_chars);
+    entry->length += inserted - deleted;
+}
+
+void document_index_remove(ShortcutJump *sj, ScintillaObject *sci) {
+    if (sj->document_indexes) {
+        g_hash_table_remove(sj->document_indexes, sci);
+    }
+}
+
+void document_index_free(ShortcutJump *sj) {
+    if (sj->document_indexes) {
+        g_hash_table_destroy(sj->document_indexes);
+        sj->document_indexes = NULL;
+    }
+}
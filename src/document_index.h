@@ -0,0 +1,33 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef DOCUMENT_INDEX_H_
+#define DOCUMENT_INDEX_H_
+
+#include <geanyplugin.h>
+
+#include "jump_to_a_word.h"
+
+gboolean document_index_defers_text(ShortcutJump *sj);
+gboolean document_index_get_view_spans(ShortcutJump *sj, GArray *spans);
+void document_index_complete(ShortcutJump *sj);
+void document_index_update(ShortcutJump *sj, ScintillaObject *sci, const SCNotification *nt);
+void document_index_remove(ShortcutJump *sj, ScintillaObject *sci);
+void document_index_free(ShortcutJump *sj);
+
+#endif
@@ -25,11 +25,6 @@
 #include "values.h"
 
 void duplicate_end(ShortcutJump *sj) {
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        g_string_free(word.word, TRUE);
-    }
-
     free_sj_values(sj);
     sj->current_mode = JM_NONE;
 }
@@ -67,7 +62,7 @@ void multicursor_duplicate_cancel(ShortcutJump *sj) {
         Word word = g_array_index(sj->multicursor_words, Word, i);
 
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.length);
     }
 
     toggle_multicursor_menu(sj, FALSE);
@@ -104,7 +99,7 @@ void duplicate_string(ShortcutJump *sj) {
 
         if (word.valid_search) {
             gint start = sj->first_position + word.replace_pos + chars_added;
-            gint len = word.word->len;
+            gint len = word.length;
 
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
             scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
@@ -113,10 +108,11 @@ void duplicate_string(ShortcutJump *sj) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
             scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
 
-            scintilla_send_message(sj->sci, SCI_INSERTTEXT, word.starting_doc + word.word->len + chars_added,
-                                   (sptr_t)word.word->str);
+            scintilla_send_message(sj->sci, SCI_SETTARGETSTART, start + len, 0);
+            scintilla_send_message(sj->sci, SCI_SETTARGETEND, start + len, 0);
+            scintilla_send_message(sj->sci, SCI_REPLACETARGET, len, (sptr_t)(sj->buffer->str + word.replace_pos));
 
-            chars_added += word.word->len;
+            chars_added += word.length;
         }
     }
 
@@ -137,12 +133,15 @@ void duplicate_string_for_multicursor(ShortcutJump *sj) {
         Word word = g_array_index(sj->multicursor_words, Word, i);
 
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting + chars_added, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting + chars_added, word.length);
+
+        gint start = word.starting_doc + chars_added;
+        gchar *text = sci_get_contents_range(sj->sci, start, start + word.length);
 
-        scintilla_send_message(sj->sci, SCI_INSERTTEXT, word.starting_doc + word.word->len + chars_added,
-                               (sptr_t)word.word->str);
+        scintilla_send_message(sj->sci, SCI_INSERTTEXT, start + word.length, (sptr_t)text);
+        g_free(text);
 
-        chars_added += word.word->len;
+        chars_added += word.length;
     }
 
     multicursor_duplicate_complete(sj);
@@ -0,0 +1,119 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "edit_stats.h"
+#include "values.h"
+
+#ifdef EDIT_STATS
+
+/*
+ * Counts what the plugin's temporary edits cost the rest of the editor between a mode's init and its end: every
+ * notification Geany hands to editor-notify listeners, the SCN_MODIFIED insertions and deletions behind them and the
+ * bytes they add to the undo history, which stay behind as redo history once the labels are undone.
+ */
+
+typedef struct {
+    guint notifications;
+    guint modified;
+    guint inserts;
+    guint deletes;
+    guint undo_actions;
+    guint undone;
+    guint savepoints_left;
+    guint savepoints_reached;
+    gsize bytes_recorded;
+    gsize bytes_undone;
+} EditStats;
+
+static EditStats stats;
+static gboolean active = FALSE;
+
+void edit_stats_begin_activation(void) {
+    stats = (EditStats){0};
+    active = TRUE;
+}
+
+void edit_stats_notify(const SCNotification *nt) {
+    if (!active) {
+        return;
+    }
+
+    stats.notifications++;
+
+    if (nt->nmhdr.code == SCN_SAVEPOINTLEFT) {
+        stats.savepoints_left++;
+        return;
+    }
+
+    if (nt->nmhdr.code == SCN_SAVEPOINTREACHED) {
+        stats.savepoints_reached++;
+        return;
+    }
+
+    if (nt->nmhdr.code != SCN_MODIFIED) {
+        return;
+    }
+
+    stats.modified++;
+
+    if (!(nt->modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT))) {
+        return;
+    }
+
+    if (nt->modificationType & SC_MOD_INSERTTEXT) {
+        stats.inserts++;
+    } else {
+        stats.deletes++;
+    }
+
+    if (nt->modificationType & SC_PERFORMED_USER) {
+        stats.bytes_recorded += nt->length;
+
+        if (nt->modificationType & SC_STARTACTION) {
+            stats.undo_actions++;
+        }
+    } else if (nt->modificationType & SC_PERFORMED_UNDO) {
+        stats.undone++;
+        stats.bytes_undone += nt->length;
+    }
+}
+
+void edit_stats_report(const gchar *mode) {
+    if (!active) {
+        return;
+    }
+
+    ScintillaObject *sci = get_scintilla_object();
+    gboolean can_redo = sci && scintilla_send_message(sci, SCI_CANREDO, 0, 0);
+
+    msgwin_status_add(_("%s: %u editor notifications, %u SCN_MODIFIED (%u insert%s, %u delete%s, %u undone)."), mode,
+                      stats.notifications, stats.modified, stats.inserts, stats.inserts == 1 ? "" : "s",
+                      stats.deletes, stats.deletes == 1 ? "" : "s", stats.undone);
+    msgwin_status_add(_("%s: %u undo action%s recording %" G_GSIZE_FORMAT " bytes, %" G_GSIZE_FORMAT
+                        " bytes undone, redo history %s."),
+                      mode, stats.undo_actions, stats.undo_actions == 1 ? "" : "s", stats.bytes_recorded,
+                      stats.bytes_undone, can_redo ? _("left behind") : _("empty"));
+
+    g_debug("%s: savepoint left %u, reached %u", mode, stats.savepoints_left, stats.savepoints_reached);
+
+    active = FALSE;
+}
+
+#endif
@@ -0,0 +1,38 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef EDIT_STATS_H_
+#define EDIT_STATS_H_
+
+#include <geanyplugin.h>
+
+#ifdef EDIT_STATS
+
+void edit_stats_begin_activation(void);
+void edit_stats_notify(const SCNotification *nt);
+void edit_stats_report(const gchar *mode);
+
+#else
+
+#define edit_stats_begin_activation()
+#define edit_stats_notify(nt)
+#define edit_stats_report(mode)
+
+#endif
+
+#endif
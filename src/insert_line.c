@@ -47,7 +47,7 @@ static void line_insert_delete_blank_lines(ShortcutJump *sj) {
         for (gint i = 0; i < sj->words->len; i++) {
             Word word = g_array_index(sj->words, Word, i);
             gint pos = scintilla_send_message(sj->sci, SCI_POSITIONFROMLINE, word.line - lines_removed, 0);
-            scintilla_send_message(sj->sci, SCI_DELETERANGE, pos, word.word->len);
+            scintilla_send_message(sj->sci, SCI_DELETERANGE, pos, word.length);
             lines_removed++;
         }
     }
@@ -81,26 +81,11 @@ static void line_insert_done_common(ShortcutJump *sj) {
 }
 
 void line_insert_end(ShortcutJump *sj) {
-    for (gint i = 0; i < sj->searched_words_for_line_insert->len; i++) {
-        Word word = g_array_index(sj->searched_words_for_line_insert, Word, i);
-        g_string_free(word.word, TRUE);
-    }
-
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        g_string_free(word.word, TRUE);
-    }
-
     free_sj_values(sj);
     sj->current_mode = JM_NONE;
 }
 
 void multicursor_line_insert_end(ShortcutJump *sj) {
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        g_string_free(word.word, TRUE);
-    }
-
     g_array_free(sj->words, TRUE);
     g_string_free(sj->cache, TRUE);
     g_string_free(sj->replace_cache, TRUE);
@@ -160,7 +145,7 @@ static GArray *line_insert_get_unique_lines(ShortcutJump *sj, GArray *lines, GAr
                 line_number = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, word.starting_doc, 0);
             } else {
                 line_number =
-                    scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, word.starting_doc + word.word->len, 0);
+                    scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, word.starting_doc + word.length, 0);
             }
 
             gint line_start_pos = scintilla_send_message(sj->sci, SCI_POSITIONFROMLINE, line_number, 0);
@@ -220,7 +205,7 @@ static GArray *line_insert_get_dummy_lines(ShortcutJump *sj, GArray *unique_line
 
         Word dummy_word;
 
-        dummy_word.word = g_string_new(dummy_string->str);
+        dummy_word.length = dummy_string->len;
         dummy_word.line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, dummy_string_pos, 0);
         dummy_word.starting = dummy_string_pos + dummy_string->len - 1;
         dummy_word.starting_doc = dummy_string_pos + dummy_string->len - 1;
@@ -234,6 +219,7 @@ static GArray *line_insert_get_dummy_lines(ShortcutJump *sj, GArray *unique_line
             sj->multicursor_last_pos = dummy_string_pos + dummy_string->len - 1;
         }
 
+        g_string_free(dummy_string, TRUE);
         g_array_append_val(lines_to_insert, dummy_word);
         lines_added++;
     }
@@ -296,13 +282,13 @@ void clear_anchor_annotations(ScintillaObject *sci, GArray *anchors) {
         Word word = g_array_index(anchors, Word, i);
 
         scintilla_send_message(sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-        scintilla_send_message(sci, SCI_INDICATORCLEARRANGE, word.starting_doc, word.word->len);
+        scintilla_send_message(sci, SCI_INDICATORCLEARRANGE, word.starting_doc, word.length);
         scintilla_send_message(sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-        scintilla_send_message(sci, SCI_INDICATORCLEARRANGE, word.starting_doc, word.word->len);
+        scintilla_send_message(sci, SCI_INDICATORCLEARRANGE, word.starting_doc, word.length);
         scintilla_send_message(sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-        scintilla_send_message(sci, SCI_INDICATORCLEARRANGE, word.starting_doc, word.word->len);
+        scintilla_send_message(sci, SCI_INDICATORCLEARRANGE, word.starting_doc, word.length);
         scintilla_send_message(sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-        scintilla_send_message(sci, SCI_INDICATORCLEARRANGE, word.starting_doc, word.word->len);
+        scintilla_send_message(sci, SCI_INDICATORCLEARRANGE, word.starting_doc, word.length);
     }
 }
 
@@ -320,9 +306,11 @@ void insert_newline_chars(ShortcutJump *sj, GArray *anchors) {
     chars_in_doc = scintilla_send_message(sj->sci, SCI_GETLENGTH, 0, 0);
 
     Word last_word = g_array_index(anchors, Word, anchors->len - 1);
-    gint last_word_last_char_pos = last_word.starting_doc + last_word.word->len;
+    gint last_word_last_char_pos = last_word.starting_doc + last_word.length;
+
+    gchar last_word_last_char = scintilla_send_message(sj->sci, SCI_GETCHARAT, last_word_last_char_pos - 1, 0);
 
-    if (last_word.word->str[last_word.word->len - 1] == '\n' && chars_in_doc == last_word_last_char_pos) {
+    if (last_word_last_char == '\n' && chars_in_doc == last_word_last_char_pos) {
         scintilla_send_message(sj->sci, SCI_INSERTTEXT, chars_in_doc, (sptr_t) "\n");
         sj->added_new_line_insert += 1;
     }
@@ -18,14 +18,19 @@
 
 #include <plugindata.h>
 
+#include "document_index.h"
 #include "duplicate_string.h"
 #include "insert_line.h"
 #include "jump_to_a_word.h"
+#include "label_overlay.h"
+#include "latency.h"
 #include "line_options.h"
 #include "multicursor.h"
 #include "paste.h"
 #include "preferences.h"
+#include "prewarm.h"
 #include "previous_cursor.h"
+#include "recorder.h"
 #include "repeat_action.h"
 #include "replace_instant.h"
 #include "search_substring.h"
@@ -33,9 +38,12 @@
 #include "shortcut_char.h"
 #include "shortcut_line.h"
 #include "shortcut_word.h"
+#include "style_filter.h"
+#include "trace.h"
 #include "transpose_string.h"
 #include "util.h"
 #include "values.h"
+#include "view_cache.h"
 
 const struct {
     gchar *label;
@@ -68,12 +76,25 @@ const struct {
                     {"Transpose selection", RA_TRANSPOSE_STRING},
                     {"Duplicate selection", RA_DUPLICATE}};
 
+const struct {
+    gchar *label;
+    TargetStyles type;
+} target_styles_conf[] = {{"All text", TS_ALL},
+                          {"Code only", TS_CODE},
+                          {"Comments only", TS_COMMENTS},
+                          {"Strings only", TS_STRINGS}};
+
 void handle_action(gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
     ReplaceAction ra = sj->config_settings->replace_action;
     MulticusrorMode mm = sj->multicursor_mode;
     JumpMode jm = sj->current_mode;
 
+    /* Every action on the words of a search acts on all of them, so a search waiting on the index finishes it first */
+    if (jm == JM_SEARCH) {
+        document_index_complete(sj);
+    }
+
     if (sj->config_settings->instant_transpose && mm == MC_ACCEPTING) {
         if (jm == JM_NONE) {
             gint valid_count = 0;
@@ -181,9 +202,36 @@ static void on_cancel(GObject *obj, GeanyDocument *doc, gpointer user_data) {
     cancel_actions(sj);
 }
 
+static void on_document_words_changed(GObject *obj, GeanyDocument *doc, gpointer user_data) {
+    ShortcutJump *sj = (ShortcutJump *)user_data;
+    clear_word_chars(sj);
+    document_index_remove(sj, doc->editor->sci);
+    view_cache_clear(sj);
+}
+
+static void on_filetype_set(GObject *obj, GeanyDocument *doc, GeanyFiletype *filetype_old, gpointer user_data) {
+    on_document_words_changed(obj, doc, user_data);
+}
+
 static gboolean on_editor_notify(GObject *obj, GeanyEditor *editor, const SCNotification *nt, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
 
+    edit_stats_notify(nt);
+
+    if (nt->nmhdr.code == SCN_MODIFIED && nt->modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT)) {
+        clear_line_starts(sj);
+        document_index_update(sj, editor->sci, nt);
+
+        /* Tags written into the document are always undone, so they leave its words and version as they were */
+        if (!sj->placing_tags) {
+            sj->document_version++;
+        }
+    }
+
+    if (nt->nmhdr.code == SCN_UPDATEUI && nt->updated & (SC_UPDATE_V_SCROLL | SC_UPDATE_CONTENT)) {
+        prewarm_schedule(sj);
+    }
+
     if (sj->multicursor_mode == MC_ACCEPTING && nt->nmhdr.code == SCN_UPDATEUI && nt->updated == SC_UPDATE_SELECTION) {
         sj->sci = get_scintilla_object();
         gint selection_start = scintilla_send_message(sj->sci, SCI_GETSELECTIONSTART, 0, 0);
@@ -365,6 +413,15 @@ static void setup_menu_and_keybindings(GeanyPlugin *plugin, ShortcutJump *sj) {
     SET_KEYBINDING("Open replacement options window", "open_replace_options", open_replace_options_kb,
                    KB_OPEN_REPLACE_OPTIONS, sj, item);
 
+    SET_MENU_ITEM("_Dump Activation Trace", trace_dump_cb, NULL);
+    SET_MENU_ITEM("Show _Keystroke Latency", latency_show_cb, NULL);
+    SET_MENU_ITEM("Reset Keystroke Late_ncy", latency_reset_cb, NULL);
+
+    item = gtk_check_menu_item_new_with_mnemonic(_("Record _Interactions"));
+    g_signal_connect(item, "toggled", G_CALLBACK(recorder_menu_toggled), NULL);
+    gtk_widget_show(item);
+    gtk_menu_shell_append(GTK_MENU_SHELL(submenu), item);
+
     SET_MENU_SEPERATOR();
 
     item = gtk_check_menu_item_new_with_mnemonic(_("_Enable Multicursor Mode"));
@@ -390,61 +447,13 @@ static void setup_menu_and_keybindings(GeanyPlugin *plugin, ShortcutJump *sj) {
 }
 
 static gboolean setup_config_settings(GeanyPlugin *plugin, gpointer pdata, ShortcutJump *sj) {
-#define SET_SETTING_BOOL(name, name_str, category, default)                                                            \
-    G_STMT_START { sj->config_settings->name = utils_get_setting_boolean(config, category, name_str, default); }       \
-    G_STMT_END
-
-#define SET_SETTING_INTEGER(name, name_str, category, default)                                                         \
-    G_STMT_START { sj->config_settings->name = utils_get_setting_integer(config, category, name_str, default); }       \
-    G_STMT_END
-
-#define SET_SETTING_COLOR(name, name_str, default)                                                                     \
-    G_STMT_START { sj->config_settings->name = utils_get_setting_integer(config, "colors", name_str, default); }       \
-    G_STMT_END
-
     GKeyFile *config = g_key_file_new();
 
     sj->config_file = g_strconcat(sj->geany_data->app->configdir, G_DIR_SEPARATOR_S, "plugins", G_DIR_SEPARATOR_S,
                                   "jump-to-a-word", G_DIR_SEPARATOR_S, "jump-to-a-word.conf", NULL);
 
     g_key_file_load_from_file(config, sj->config_file, G_KEY_FILE_NONE, NULL);
-
-    SET_SETTING_BOOL(show_annotations, "show_annotations", "general", TRUE);
-    SET_SETTING_BOOL(use_selected_word_or_char, "use_selected_word_or_char", "general", TRUE);
-    SET_SETTING_BOOL(wait_for_enter, "wait_for_enter", "general", FALSE);
-    SET_SETTING_BOOL(only_tag_current_line, "only_tag_current_line", "general", FALSE);
-    SET_SETTING_BOOL(move_marker_to_line, "move_marker_to_line", "general", FALSE);
-    SET_SETTING_BOOL(cancel_on_mouse_move, "cancel_on_mouse_move", "general", FALSE);
-    SET_SETTING_BOOL(search_from_selection, "search_from_selection", "general", TRUE);
-    SET_SETTING_BOOL(search_selection_if_line, "search_selection_if_line", "general", TRUE);
-
-    SET_SETTING_BOOL(select_when_shortcut_char, "select_when_shortcut_char", "shortcut", TRUE);
-    SET_SETTING_BOOL(jump_on_single_instance, "jump_on_single_instance", "shortcut", FALSE);
-    SET_SETTING_BOOL(shortcut_all_caps, "shortcut_all_caps", "shortcut", FALSE);
-    SET_SETTING_BOOL(shortcuts_include_single_char, "shortcuts_include_single_char", "shortcut", FALSE);
-    SET_SETTING_BOOL(hide_word_shortcut_jump, "hide_word_shortcut_jump", "shortcut", FALSE);
-    SET_SETTING_BOOL(center_shortcut, "center_shortcut", "shortcut", FALSE);
-
-    SET_SETTING_BOOL(wrap_search, "wrap_search", "search", TRUE);
-    SET_SETTING_BOOL(search_start_from_beginning, "search_start_from_beginning", "search", TRUE);
-    SET_SETTING_BOOL(match_whole_word, "match_whole_word", "search", FALSE);
-    SET_SETTING_BOOL(search_case_sensitive, "search_case_sensitive", "search", TRUE);
-    SET_SETTING_BOOL(search_smart_case, "search_smart_case", "search", TRUE);
-
-    SET_SETTING_BOOL(instant_transpose, "instant_transpose", "action", FALSE);
-    SET_SETTING_BOOL(disable_live_replace, "disable_live_replace", "action", FALSE);
-
-    SET_SETTING_BOOL(whole_document, "search_whole_document", "document", TRUE);
-
-    SET_SETTING_INTEGER(text_after, "text_after", "text_after", TX_SELECT_TEXT);
-    SET_SETTING_INTEGER(line_after, "line_after", "line_after", LA_SELECT_TO_LINE);
-    SET_SETTING_INTEGER(replace_action, "replace_action", "replace_action", RA_REPLACE);
-
-    SET_SETTING_COLOR(text_color, "text_color", 0xFFFFFF);
-    SET_SETTING_COLOR(search_annotation_bg_color, "search_annotation_bg_color", 0x46383D);
-    SET_SETTING_COLOR(tag_color, "tag_color", 0xFFFFFF);
-    SET_SETTING_COLOR(highlight_color, "highlight_color", 0x00FF00);
-
+    load_settings(sj, config);
     g_key_file_free(config);
 
     return TRUE;
@@ -453,6 +462,9 @@ static gboolean setup_config_settings(GeanyPlugin *plugin, gpointer pdata, Short
 static gboolean init(GeanyPlugin *plugin, gpointer pdata) {
     ShortcutJump *sj = (ShortcutJump *)pdata;
 
+    /* The document index finds the words of large documents on worker threads, which may outlive a reload */
+    plugin_module_make_resident(plugin);
+
     setup_menu_and_keybindings(plugin, sj);
     setup_config_settings(plugin, pdata, sj);
 
@@ -464,18 +476,25 @@ static gboolean init(GeanyPlugin *plugin, gpointer pdata) {
 static void cleanup(GeanyPlugin *plugin, gpointer pdata) {
     ShortcutJump *sj = (ShortcutJump *)pdata;
     end_actions(sj);
+    latency_cleanup();
+    document_index_free(sj);
+    prewarm_free(sj);
+    label_overlay_hide(sj);
+    view_cache_free(sj);
+    style_filter_free(sj);
+    free_spare_values(sj);
 
     if (sj->has_previous_action) {
         g_string_free(sj->previous_search_query, TRUE);
         g_string_free(sj->previous_replace_query, TRUE);
     }
 
-    if (sj->tl_window->panel) {
+    if (sj->tl_window) {
         gtk_widget_destroy(sj->tl_window->panel);
-    }
 
-    if (sj->tl_window->last_path) {
-        gtk_tree_path_free(sj->tl_window->last_path);
+        if (sj->tl_window->last_path) {
+            gtk_tree_path_free(sj->tl_window->last_path);
+        }
     }
 
     g_free(sj->config_settings);
@@ -513,6 +532,10 @@ static void smart_case_toggle_cb(GtkToggleButton *toggle_button, gpointer data)
 static GtkWidget *configure(GeanyPlugin *plugin, GtkDialog *dialog, gpointer pdata) {
     ShortcutJump *sj = (ShortcutJump *)pdata;
 
+    if (!sj->gdk_colors) {
+        sj->gdk_colors = g_new0(Colors, 1);
+    }
+
 #define HORIZONTAL_FRAME()                                                                                             \
     G_STMT_START {                                                                                                     \
         hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 0);                                                             \
@@ -648,6 +671,9 @@ static GtkWidget *configure(GeanyPlugin *plugin, GtkDialog *dialog, gpointer pda
     tt = "Place shortcuts in the middle of words instead of the left";
     WIDGET_CONF_BOOL(center_shortcut, "_Position shortcuts in middle of words", tt);
 
+    tt = "Draw the shortcuts over the text instead of writing them into the document";
+    WIDGET_CONF_BOOL(label_overlay, "Dr_aw shortcuts over the text", tt);
+
     /*
      * Jumping to a word or substring using search
      */
@@ -719,6 +745,21 @@ static GtkWidget *configure(GeanyPlugin *plugin, GtkDialog *dialog, gpointer pda
     gtk_box_pack_start(GTK_BOX(container), sj->config_widgets->line_after, FALSE, FALSE, 0);
     gtk_combo_box_set_active(GTK_COMBO_BOX(sj->config_widgets->line_after), sj->config_settings->line_after);
 
+    /*
+     * Words, characters, and substrings to jump to
+     */
+
+    WIDGET_FRAME("Words, characters, and substrings to jump to", GTK_ORIENTATION_VERTICAL);
+    sj->config_widgets->target_styles = gtk_combo_box_text_new();
+
+    for (gint i = 0; i < TS_COUNT; i++) {
+        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(sj->config_widgets->target_styles),
+                                       target_styles_conf[i].label);
+    }
+
+    gtk_box_pack_start(GTK_BOX(container), sj->config_widgets->target_styles, FALSE, FALSE, 0);
+    gtk_combo_box_set_active(GTK_COMBO_BOX(sj->config_widgets->target_styles), sj->config_settings->target_styles);
+
     /*
      * Replacement action
      */
@@ -763,6 +804,8 @@ static PluginCallback callbacks[] = {{"document-before-save", (GCallback)&on_can
                                      {"document-before-save-as", (GCallback)&on_cancel, TRUE, NULL},
                                      {"document-activate", (GCallback)&on_cancel, TRUE, NULL},
                                      {"document-reload", (GCallback)&on_cancel, TRUE, NULL},
+                                     {"document-filetype-set", (GCallback)&on_filetype_set, TRUE, NULL},
+                                     {"document-close", (GCallback)&on_document_words_changed, TRUE, NULL},
                                      {"editor-notify", (GCallback)&on_editor_notify, TRUE, NULL},
                                      {NULL, NULL, FALSE, NULL}};
 
@@ -775,8 +818,6 @@ ShortcutJump *init_data(const GeanyPlugin *plugin) {
 
     sj->config_settings = g_new0(Settings, 1);
     sj->config_widgets = g_new0(Widgets, 1);
-    sj->gdk_colors = g_new0(Colors, 1);
-    sj->tl_window = g_new0(TextLineWindow, 1);
 
     sj->has_previous_action = FALSE;
 
@@ -784,12 +825,28 @@ ShortcutJump *init_data(const GeanyPlugin *plugin) {
     sj->multicursor_first_pos = 0;
     sj->multicursor_last_pos = 0;
 
-    sj->tl_window->panel = NULL;
-    sj->tl_window->entry = NULL;
-    sj->tl_window->view = NULL;
-    sj->tl_window->store = NULL;
-    sj->tl_window->sort = NULL;
-    sj->tl_window->last_path = NULL;
+    /* Created on first use by configure and the options window so loading the plugin stays cheap */
+    sj->gdk_colors = NULL;
+    sj->tl_window = NULL;
+
+    sj->line_starts = NULL;
+    sj->word_chars_sci = NULL;
+    sj->document_indexes = NULL;
+    sj->document_index_pending = FALSE;
+    sj->document_version = 0;
+    sj->placing_tags = FALSE;
+    sj->view_cache_sci = NULL;
+    sj->view_cache_spans = NULL;
+    sj->prewarm_source_id = 0;
+    sj->label_overlay_widget = NULL;
+    sj->label_overlay_handler_id = 0;
+    sj->label_overlay_font = NULL;
+    sj->style_filter_text = NULL;
+    sj->style_filter_loaded = FALSE;
+    sj->style_filter_end = 0;
+    sj->spare_strings = NULL;
+    sj->spare_words = NULL;
+    sj->spare_positions = NULL;
 
     sj->sci = NULL;
     sj->in_selection = FALSE;
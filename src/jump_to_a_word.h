@@ -21,19 +21,30 @@
 
 #include <geanyplugin.h>
 
+#include "core/label.h"
+#include "core/tokenizer.h"
+#include "sci_stats.h"
+#include "alloc_stats.h"
+#include "edit_stats.h"
+
+/*
+ * The fields every per-keystroke scan reads (position, length and flags) come first and share the first twelve bytes,
+ * and the rest is kept narrow, so whole-document searches walk a dense array.
+ */
 typedef struct {
     gint starting;
+    gint length;
+    guint valid_search : 1;
+    guint shortcut_marked : 1;
+    guint is_hidden_neighbor : 1;
+    gint8 bytes;
+    guint8 shortcut_length;
     gint starting_doc;
-    GString *word;
-    GString *shortcut;
     gint line;
     gint padding;
-    gint bytes;
     gint replace_pos;
     gint replace_pos_start;
-    gboolean valid_search;
-    gboolean shortcut_marked;
-    gboolean is_hidden_neighbor;
+    gchar shortcut[LABEL_MAX_LENGTH];
 } Word;
 
 typedef enum {
@@ -115,6 +126,14 @@ typedef enum {
     RA_COUNT,
 } ReplaceAction;
 
+typedef enum {
+    TS_ALL,
+    TS_CODE,
+    TS_COMMENTS,
+    TS_STRINGS,
+    TS_COUNT,
+} TargetStyles;
+
 typedef enum {
     SOURCE_SETTINGS_CHANGE,
     SOURCE_OPTION_MENU,
@@ -152,6 +171,7 @@ typedef struct {
     gboolean disable_live_replace;
     gboolean whole_document;
     gboolean jump_on_single_instance;
+    gboolean label_overlay;
 
     gint tag_color;
     gint text_color;
@@ -161,6 +181,7 @@ typedef struct {
     LineAfter line_after;
     TextAfter text_after;
     ReplaceAction replace_action;
+    TargetStyles target_styles;
 } Settings;
 
 typedef struct {
@@ -188,11 +209,13 @@ typedef struct {
     GtkWidget *line_after;
     GtkWidget *text_after;
     GtkWidget *replace_action;
+    GtkWidget *target_styles;
     GtkWidget *select_when_shortcut_char;
     GtkWidget *search_smart_case;
     GtkWidget *instant_transpose;
     GtkWidget *disable_live_replace;
     GtkWidget *jump_on_single_instance;
+    GtkWidget *label_overlay;
 } Widgets;
 
 typedef struct {
@@ -255,6 +278,7 @@ typedef struct {
     GString *cache;
     GString *buffer;
     GString *replace_cache;
+    gint text_end;
 
     GArray *markers;
     GArray *words;
@@ -263,6 +287,37 @@ typedef struct {
 
     GArray *lf_positions;
 
+    GArray *line_starts;
+    gint line_starts_first_line;
+
+    WordChars word_chars;
+    ScintillaObject *word_chars_sci;
+    GHashTable *document_indexes;
+    gboolean document_index_pending;
+
+    guint document_version;
+    gboolean placing_tags;
+
+    ScintillaObject *view_cache_sci;
+    gint view_cache_first_position;
+    gint view_cache_last_position;
+    guint view_cache_version;
+    GArray *view_cache_spans;
+    guint prewarm_source_id;
+
+    GtkWidget *label_overlay_widget;
+    gulong label_overlay_handler_id;
+    PangoFontDescription *label_overlay_font;
+
+    GString *style_filter_text;
+    gboolean style_filter_loaded;
+    gint style_filter_end;
+    gboolean style_filter_allowed[256];
+
+    GPtrArray *spare_strings;
+    GPtrArray *spare_words;
+    GPtrArray *spare_positions;
+
     gboolean replace_instant;
 
     gboolean range_is_set;
@@ -0,0 +1,161 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "label_overlay.h"
+
+/*
+ * With the label overlay on, the shortcuts of a jump are drawn over the text area after Scintilla has painted it,
+ * at the positions SCI_POINTXFROMPOSITION and SCI_POINTYFROMPOSITION give, and the document is never written. Each
+ * label is painted the way the tag and text indicators would paint it in the document, over the editor background.
+ */
+
+#define LABEL_OVERLAY_FILL_ALPHA (30 / 255.0)
+#define LABEL_OVERLAY_OUTLINE_ALPHA (120 / 255.0)
+#define LABEL_OVERLAY_HIGHLIGHT_ALPHA (120 / 255.0)
+
+/* Scintilla colors are 0xBBGGRR */
+static void label_overlay_set_color(cairo_t *cr, gint color, gdouble alpha) {
+    cairo_set_source_rgba(cr, (color & 0xFF) / 255.0, ((color >> 8) & 0xFF) / 255.0, ((color >> 16) & 0xFF) / 255.0,
+                          alpha);
+}
+
+/* The font of the default style at the zoom of the view, looked up once when the labels are shown */
+static PangoFontDescription *label_overlay_get_font(ScintillaObject *sci) {
+    gint length = scintilla_send_message(sci, SCI_STYLEGETFONT, STYLE_DEFAULT, 0);
+    gchar *family = g_malloc0(length + 1);
+
+    scintilla_send_message(sci, SCI_STYLEGETFONT, STYLE_DEFAULT, (sptr_t)family);
+
+    PangoFontDescription *font = pango_font_description_from_string(family);
+    gint size = scintilla_send_message(sci, SCI_STYLEGETSIZEFRACTIONAL, STYLE_DEFAULT, 0) +
+                scintilla_send_message(sci, SCI_GETZOOM, 0, 0) * SC_FONT_SIZE_MULTIPLIER;
+
+    pango_font_description_set_size(font, MAX(size, SC_FONT_SIZE_MULTIPLIER) * PANGO_SCALE / SC_FONT_SIZE_MULTIPLIER);
+    g_free(family);
+
+    return font;
+}
+
+static gboolean label_overlay_draw(GtkWidget *widget, cairo_t *cr, gpointer user_data) {
+    ShortcutJump *sj = (ShortcutJump *)user_data;
+    ScintillaObject *sci = sj->sci;
+    PangoLayout *layout = gtk_widget_create_pango_layout(widget, NULL);
+    gint line_height = scintilla_send_message(sci, SCI_TEXTHEIGHT, 0, 0);
+    gint background = scintilla_send_message(sci, SCI_STYLEGETBACK, STYLE_DEFAULT, 0);
+    gboolean hide_words = sj->current_mode == JM_SHORTCUT_WORD && sj->config_settings->hide_word_shortcut_jump;
+
+    pango_layout_set_font_description(layout, sj->label_overlay_font);
+
+    for (gint i = 0; i < sj->words->len; i++) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+
+        if (word->is_hidden_neighbor) {
+            continue;
+        }
+
+        gint position = word->starting_doc + word->padding;
+        gint x = scintilla_send_message(sci, SCI_POINTXFROMPOSITION, 0, position);
+        gint y = scintilla_send_message(sci, SCI_POINTYFROMPOSITION, 0, position);
+        gint width;
+
+        pango_layout_set_text(layout, word->shortcut, word->shortcut_length);
+        pango_layout_get_pixel_size(layout, &width, NULL);
+
+        if (hide_words) {
+            gint word_x = scintilla_send_message(sci, SCI_POINTXFROMPOSITION, 0, word->starting_doc);
+            gint word_end = scintilla_send_message(sci, SCI_POINTXFROMPOSITION, 0, word->starting_doc + word->length);
+
+            label_overlay_set_color(cr, background, 1);
+            cairo_rectangle(cr, word_x, y, word_end - word_x, line_height);
+            cairo_fill(cr);
+        }
+
+        label_overlay_set_color(cr, background, 1);
+        cairo_rectangle(cr, x, y, width, line_height);
+        cairo_fill(cr);
+
+        label_overlay_set_color(cr, sj->config_settings->tag_color, LABEL_OVERLAY_FILL_ALPHA);
+        cairo_rectangle(cr, x, y, width, line_height);
+        cairo_fill_preserve(cr);
+        label_overlay_set_color(cr, sj->config_settings->tag_color, LABEL_OVERLAY_OUTLINE_ALPHA);
+        cairo_set_line_width(cr, 1);
+        cairo_stroke(cr);
+
+        if (word->shortcut_marked) {
+            gint typed_width;
+
+            pango_layout_set_text(layout, word->shortcut, MIN(sj->search_query->len, word->shortcut_length));
+            pango_layout_get_pixel_size(layout, &typed_width, NULL);
+            label_overlay_set_color(cr, sj->config_settings->highlight_color, LABEL_OVERLAY_HIGHLIGHT_ALPHA);
+            cairo_rectangle(cr, x, y, typed_width, line_height);
+            cairo_fill(cr);
+            pango_layout_set_text(layout, word->shortcut, word->shortcut_length);
+        }
+
+        label_overlay_set_color(cr, sj->config_settings->text_color, 1);
+        cairo_move_to(cr, x, y);
+        pango_cairo_show_layout(cr, layout);
+    }
+
+    g_object_unref(layout);
+
+    return FALSE;
+}
+
+/* Scintilla paints its text into a drawing area inside the ScintillaObject, which is where the labels go */
+static void label_overlay_find_text_area(GtkWidget *widget, gpointer data) {
+    if (GTK_IS_DRAWING_AREA(widget)) {
+        *(GtkWidget **)data = widget;
+    }
+}
+
+void label_overlay_show(ShortcutJump *sj) {
+    GtkWidget *text_area = NULL;
+
+    /* The headless benchmark editor is not a widget and has nothing to draw on */
+    if (sj->label_overlay_widget || !GTK_IS_CONTAINER(sj->sci)) {
+        return;
+    }
+
+    gtk_container_forall(GTK_CONTAINER(sj->sci), label_overlay_find_text_area, &text_area);
+
+    sj->label_overlay_widget = text_area ? text_area : GTK_WIDGET(sj->sci);
+    sj->label_overlay_font = label_overlay_get_font(sj->sci);
+    sj->label_overlay_handler_id =
+        g_signal_connect_after(sj->label_overlay_widget, "draw", G_CALLBACK(label_overlay_draw), sj);
+    gtk_widget_queue_draw(sj->label_overlay_widget);
+}
+
+void label_overlay_refresh(ShortcutJump *sj) {
+    if (sj->label_overlay_widget) {
+        gtk_widget_queue_draw(sj->label_overlay_widget);
+    }
+}
+
+void label_overlay_hide(ShortcutJump *sj) {
+    if (sj->label_overlay_widget) {
+        g_signal_handler_disconnect(sj->label_overlay_widget, sj->label_overlay_handler_id);
+        gtk_widget_queue_draw(sj->label_overlay_widget);
+        sj->label_overlay_widget = NULL;
+        sj->label_overlay_handler_id = 0;
+        pango_font_description_free(sj->label_overlay_font);
+        sj->label_overlay_font = NULL;
+    }
+}
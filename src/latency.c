@@ -0,0 +1,198 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "jump_to_a_word.h"
+#include "latency.h"
+
+/*
+ * Measures the time from a key press reaching one of the interactive loops to the first idle callback after it. The
+ * callback runs at default idle priority, below GTK's redraw, so the interval covers the handler and the repaint it
+ * caused. A key handed from one loop to another, such as a word search passing it on to replace_handle_input, is
+ * counted once under the innermost mode. Samples go into log-linear buckets (eight per power of two) so percentiles
+ * stay within about 12%.
+ */
+
+#define LATENCY_SUB_BUCKETS 8
+#define LATENCY_OCTAVES 32
+#define LATENCY_BUCKETS (LATENCY_SUB_BUCKETS * LATENCY_OCTAVES)
+#define LATENCY_PENDING_LIMIT 64
+
+typedef struct {
+    guint64 counts[LATENCY_BUCKETS];
+    guint64 samples;
+    gint64 max;
+} Histogram;
+
+typedef struct {
+    LatencyMode mode;
+    gint64 start;
+    const GdkEventKey *event;
+    guint32 time;
+    guint keyval;
+} PendingKey;
+
+static const gchar *mode_names[LATENCY_MODE_COUNT] = {
+    [LATENCY_SEARCH_WORD] = N_("Word search"),
+    [LATENCY_SEARCH_SUBSTRING] = N_("Substring search"),
+    [LATENCY_SHORTCUT] = N_("Shortcut jump"),
+    [LATENCY_REPLACE] = N_("Replace"),
+};
+
+static Histogram histograms[LATENCY_MODE_COUNT];
+static PendingKey pending[LATENCY_PENDING_LIMIT];
+static guint pending_count = 0;
+static guint idle_source = 0;
+
+static guint latency_bucket(gint64 us) {
+    if (us < LATENCY_SUB_BUCKETS) {
+        return MAX(us, 0);
+    }
+
+    guint octave = g_bit_storage(us) - 1;
+    guint sub = (us >> (octave - 3)) & (LATENCY_SUB_BUCKETS - 1);
+
+    return MIN((octave - 2) * LATENCY_SUB_BUCKETS + sub, LATENCY_BUCKETS - 1);
+}
+
+static gint64 latency_bucket_upper(guint bucket) {
+    if (bucket < LATENCY_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    guint octave = bucket / LATENCY_SUB_BUCKETS + 2;
+    guint sub = bucket % LATENCY_SUB_BUCKETS;
+
+    return ((gint64)(LATENCY_SUB_BUCKETS + sub + 1) << (octave - 3)) - 1;
+}
+
+static gint64 latency_percentile(const Histogram *histogram, gdouble percentile) {
+    guint64 rank = (guint64)(percentile * histogram->samples / 100.0 + 0.5);
+    guint64 seen = 0;
+
+    rank = CLAMP(rank, 1, histogram->samples);
+
+    for (guint i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += histogram->counts[i];
+
+        if (seen >= rank) {
+            return MIN(latency_bucket_upper(i), histogram->max);
+        }
+    }
+
+    return histogram->max;
+}
+
+static void latency_record(LatencyMode mode, gint64 us) {
+    Histogram *histogram = &histograms[mode];
+
+    histogram->counts[latency_bucket(us)]++;
+    histogram->samples++;
+    histogram->max = MAX(histogram->max, us);
+}
+
+static gboolean latency_on_idle(gpointer user_data) {
+    gint64 now = g_get_monotonic_time();
+
+    for (guint i = 0; i < pending_count; i++) {
+        latency_record(pending[i].mode, now - pending[i].start);
+    }
+
+    pending_count = 0;
+    idle_source = 0;
+
+    return G_SOURCE_REMOVE;
+}
+
+void latency_begin(LatencyMode mode, const GdkEventKey *event) {
+    if (pending_count > 0) {
+        PendingKey *last = &pending[pending_count - 1];
+
+        if (last->event == event && last->time == event->time && last->keyval == event->keyval) {
+            last->mode = mode;
+            return;
+        }
+    }
+
+    if (pending_count == LATENCY_PENDING_LIMIT) {
+        return;
+    }
+
+    PendingKey *key = &pending[pending_count++];
+
+    key->mode = mode;
+    key->start = g_get_monotonic_time();
+    key->event = event;
+    key->time = event->time;
+    key->keyval = event->keyval;
+
+    if (idle_source == 0) {
+        idle_source = g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, latency_on_idle, NULL, NULL);
+    }
+}
+
+void latency_show(void) {
+    gboolean any = FALSE;
+
+    for (gint i = 0; i < LATENCY_MODE_COUNT; i++) {
+        const Histogram *histogram = &histograms[i];
+
+        if (histogram->samples == 0) {
+            continue;
+        }
+
+        if (!any) {
+            msgwin_status_add(_("Jump to a Word keystroke latency:"));
+            any = TRUE;
+        }
+
+        msgwin_status_add(_("%s: %lu keystroke%s, p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms"),
+                          _(mode_names[i]), (gulong)histogram->samples, histogram->samples == 1 ? "" : "s",
+                          latency_percentile(histogram, 50) / 1000.0, latency_percentile(histogram, 95) / 1000.0,
+                          latency_percentile(histogram, 99) / 1000.0, histogram->max / 1000.0);
+    }
+
+    if (!any) {
+        ui_set_statusbar(TRUE, _("No keystroke latency has been recorded."));
+        return;
+    }
+
+    msgwin_switch_tab(MSG_STATUS, TRUE);
+}
+
+void latency_reset(void) {
+    for (gint i = 0; i < LATENCY_MODE_COUNT; i++) {
+        histograms[i] = (Histogram){0};
+    }
+
+    ui_set_statusbar(TRUE, _("Keystroke latency reset."));
+}
+
+void latency_cleanup(void) {
+    if (idle_source != 0) {
+        g_source_remove(idle_source);
+        idle_source = 0;
+    }
+
+    pending_count = 0;
+}
+
+void latency_show_cb(GtkMenuItem *menu_item, gpointer user_data) { latency_show(); }
+
+void latency_reset_cb(GtkMenuItem *menu_item, gpointer user_data) { latency_reset(); }
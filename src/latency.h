@@ -0,0 +1,39 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+#include <geanyplugin.h>
+
+typedef enum {
+    LATENCY_SEARCH_WORD,
+    LATENCY_SEARCH_SUBSTRING,
+    LATENCY_SHORTCUT,
+    LATENCY_REPLACE,
+    LATENCY_MODE_COUNT,
+} LatencyMode;
+
+void latency_begin(LatencyMode mode, const GdkEventKey *event);
+void latency_show(void);
+void latency_reset(void);
+void latency_cleanup(void);
+void latency_show_cb(GtkMenuItem *menu_item, gpointer user_data);
+void latency_reset_cb(GtkMenuItem *menu_item, gpointer user_data);
+
+#endif
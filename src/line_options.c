@@ -298,10 +298,7 @@ static void on_panel_hide(GtkWidget *widget, gpointer dummy) {
     gtk_list_store_clear(sj->tl_window->store);
 }
 
-static void on_panel_show(GtkWidget *widget, gpointer dummy) {
-    ShortcutJump *sj = (ShortcutJump *)dummy;
-    GtkTreePath *path;
-    GtkTreeView *view = GTK_TREE_VIEW(sj->tl_window->view);
+static void fill_store(const ShortcutJump *sj) {
     if (sj->option_mod == OM_LINE) {
         fill_store_line(sj, sj->tl_window->store);
     } else if (sj->option_mod == OM_TEXT) {
@@ -309,6 +306,13 @@ static void on_panel_show(GtkWidget *widget, gpointer dummy) {
     } else if (sj->option_mod == OM_REPLACE) {
         fill_store_replace(sj, sj->tl_window->store);
     }
+}
+
+static void on_panel_show(GtkWidget *widget, gpointer dummy) {
+    ShortcutJump *sj = (ShortcutJump *)dummy;
+    GtkTreePath *path;
+    GtkTreeView *view = GTK_TREE_VIEW(sj->tl_window->view);
+    fill_store(sj);
     gtk_widget_grab_focus(sj->tl_window->entry);
     if (sj->tl_window->last_path) {
         gtk_tree_view_set_cursor(view, sj->tl_window->last_path, NULL, FALSE);
@@ -326,10 +330,7 @@ static void on_panel_show(GtkWidget *widget, gpointer dummy) {
 }
 
 static void create_panel(ShortcutJump *sj) {
-    if (sj->multicursor_mode == MC_DISABLED) {
-        cancel_actions(sj);
-    }
-
+    sj->tl_window = g_new0(TextLineWindow, 1);
     sj->tl_window->panel =
         g_object_new(GTK_TYPE_WINDOW, "decorated", FALSE, "default-width", 275, "default-height", 275, "transient-for",
                      sj->geany_data->main_widgets->window, "window-position", GTK_WIN_POS_CENTER_ON_PARENT, "type-hint",
@@ -373,52 +374,67 @@ static void create_panel(ShortcutJump *sj) {
     g_signal_connect(sj->tl_window->panel, "hide", G_CALLBACK(on_panel_hide), sj);
     g_signal_connect(sj->tl_window->panel, "key-press-event", G_CALLBACK(on_panel_key_press_event), sj);
     g_signal_connect(sj->tl_window->entry, "notify::text", G_CALLBACK(on_entry_text_notify), sj);
-    g_signal_connect(sj->tl_window->entry, "activate", G_CALLBACK(on_entry_activate), NULL);
+    g_signal_connect(sj->tl_window->entry, "activate", G_CALLBACK(on_entry_activate), sj);
 
     gtk_widget_show_all(frame);
 }
 
+static void show_panel(ShortcutJump *sj, OptionMod option_mod) {
+    if (sj->multicursor_mode == MC_DISABLED) {
+        cancel_actions(sj);
+    }
+
+    if (!sj->tl_window) {
+        create_panel(sj);
+    }
+
+    gboolean refill = gtk_widget_get_visible(sj->tl_window->panel) && sj->option_mod != option_mod;
+    sj->option_mod = option_mod;
+
+    if (refill) {
+        /* The show handler will not run again, so swap the list for the new mode here */
+        gtk_list_store_clear(sj->tl_window->store);
+        fill_store(sj);
+
+        GtkTreeIter iter;
+        if (gtk_tree_model_get_iter_first(GTK_TREE_MODEL(sj->tl_window->sort), &iter)) {
+            tree_view_set_cursor_from_iter(GTK_TREE_VIEW(sj->tl_window->view), &iter);
+        }
+    }
+
+    gtk_entry_set_text(GTK_ENTRY(sj->tl_window->entry), "");
+    gtk_widget_show(sj->tl_window->panel);
+}
+
 gboolean open_line_options_kb(GeanyKeyBinding *kb, guint key_id, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
-    sj->option_mod = OM_LINE;
-    create_panel(sj);
-    gtk_widget_show(sj->tl_window->panel);
+    show_panel(sj, OM_LINE);
     return TRUE;
 }
 
 gboolean open_text_options_kb(GeanyKeyBinding *kb, guint key_id, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
-    sj->option_mod = OM_TEXT;
-    create_panel(sj);
-    gtk_widget_show(sj->tl_window->panel);
+    show_panel(sj, OM_TEXT);
     return TRUE;
 }
 
 gboolean open_replace_options_kb(GeanyKeyBinding *kb, guint key_id, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
-    sj->option_mod = OM_REPLACE;
-    create_panel(sj);
-    gtk_widget_show(sj->tl_window->panel);
+    show_panel(sj, OM_REPLACE);
     return TRUE;
 }
 
 void open_line_options_cb(GtkMenuItem *menu_item, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
-    sj->option_mod = OM_LINE;
-    create_panel(sj);
-    gtk_widget_show(sj->tl_window->panel);
+    show_panel(sj, OM_LINE);
 }
 
 void open_text_options_cb(GtkMenuItem *menu_item, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
-    sj->option_mod = OM_TEXT;
-    create_panel(sj);
-    gtk_widget_show(sj->tl_window->panel);
+    show_panel(sj, OM_TEXT);
 }
 
 void open_replace_options_cb(GtkMenuItem *menu_item, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
-    sj->option_mod = OM_REPLACE;
-    create_panel(sj);
-    gtk_widget_show(sj->tl_window->panel);
+    show_panel(sj, OM_REPLACE);
 }
@@ -59,11 +59,6 @@ static void multicursor_start(ShortcutJump *sj) {
 }
 
 void multicursor_replace_end(ShortcutJump *sj) {
-    for (gint i = 0; i < sj->multicursor_words->len; i++) {
-        Word word = g_array_index(sj->multicursor_words, Word, i);
-        g_string_free(word.word, TRUE);
-    }
-
     g_string_free(sj->replace_query, TRUE);
 
     g_string_free(sj->replace_cache, TRUE);
@@ -77,11 +72,6 @@ void multicursor_replace_end(ShortcutJump *sj) {
 }
 
 void multicursor_end(ShortcutJump *sj) {
-    for (gint i = 0; i < sj->multicursor_words->len; i++) {
-        Word word = g_array_index(sj->multicursor_words, Word, i);
-        g_string_free(word.word, TRUE);
-    }
-
     g_string_free(sj->multicursor_eol_message, TRUE);
     g_array_free(sj->multicursor_words, TRUE);
     sj->current_mode = JM_NONE;
@@ -94,10 +84,10 @@ void multicursor_replace_clear_indicators(ShortcutJump *sj) {
         if (word.valid_search) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
             scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, sj->first_position + word.replace_pos,
-                                   sj->replace_len == 0 ? word.word->len : sj->replace_len);
+                                   sj->replace_len == 0 ? word.length : sj->replace_len);
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
             scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, sj->first_position + word.replace_pos,
-                                   sj->replace_len == 0 ? word.word->len : sj->replace_len);
+                                   sj->replace_len == 0 ? word.length : sj->replace_len);
         }
     }
 }
@@ -106,7 +96,7 @@ void multicursor_accepting_cancel(ShortcutJump *sj) {
     for (gint i = 0; i < sj->multicursor_words->len; i++) {
         Word word = g_array_index(sj->multicursor_words, Word, i);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.length);
     }
     scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
     multicursor_replace_clear_indicators(sj);
@@ -122,7 +112,7 @@ void multicursor_replace_cancel(ShortcutJump *sj) {
     for (gint i = 0; i < sj->multicursor_words->len; i++) {
         Word word = g_array_index(sj->multicursor_words, Word, i);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.length);
     }
 
     scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
@@ -162,20 +152,20 @@ void multicursor_replace_complete(ShortcutJump *sj) {
 
 void multicursor_add_word_from_selection(ShortcutJump *sj, gint start, gint end) {
     Word multicursor_word;
-    multicursor_word.word = g_string_new(sci_get_contents_range(sj->sci, start, end));
+    multicursor_word.length = end - start;
     multicursor_word.line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, start, 0);
     multicursor_word.starting = start;
     multicursor_word.starting_doc = start;
     multicursor_word.valid_search = TRUE;
 
     gint new_word_start = multicursor_word.starting_doc;
-    gint new_word_end = multicursor_word.starting_doc + multicursor_word.word->len;
+    gint new_word_end = multicursor_word.starting_doc + multicursor_word.length;
 
     for (gint i = 0; i < sj->multicursor_words->len; i++) {
         Word *word = &g_array_index(sj->multicursor_words, Word, i);
 
         gint old_word_start = word->starting_doc;
-        gint old_word_end = word->starting_doc + word->word->len;
+        gint old_word_end = word->starting_doc + word->length;
 
         if (!word->valid_search) {
             continue;
@@ -183,7 +173,7 @@ void multicursor_add_word_from_selection(ShortcutJump *sj, gint start, gint end)
 
         if (new_word_start == old_word_start && new_word_end == old_word_end) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->length);
             word->valid_search = FALSE;
             return;
         }
@@ -194,16 +184,16 @@ void multicursor_add_word_from_selection(ShortcutJump *sj, gint start, gint end)
 
         if (old_enclosed_by_new || new_start_enclosed_by_old || new_end_enclosed_by_old) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->length);
             scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, multicursor_word.starting_doc,
-                                   multicursor_word.word->len);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->word->len);
+                                   multicursor_word.length);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->length);
             word->valid_search = FALSE;
         }
     }
 
     scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-    scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, multicursor_word.starting_doc, multicursor_word.word->len);
+    scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, multicursor_word.starting_doc, multicursor_word.length);
 
     if (multicursor_word.starting_doc <= sj->multicursor_first_pos) {
         sj->multicursor_first_pos = multicursor_word.starting_doc;
@@ -219,20 +209,20 @@ void multicursor_add_word_from_selection(ShortcutJump *sj, gint start, gint end)
 void multicursor_add_word(ShortcutJump *sj, Word word) {
     Word multicursor_word;
 
-    multicursor_word.word = g_string_new(word.word->str);
+    multicursor_word.length = word.length;
     multicursor_word.line = word.line;
     multicursor_word.starting = word.starting;
     multicursor_word.starting_doc = word.starting_doc;
     multicursor_word.valid_search = TRUE;
 
     gint new_word_start = multicursor_word.starting_doc;
-    gint new_word_end = multicursor_word.starting_doc + multicursor_word.word->len;
+    gint new_word_end = multicursor_word.starting_doc + multicursor_word.length;
 
     for (gint i = 0; i < sj->multicursor_words->len; i++) {
         Word *word = &g_array_index(sj->multicursor_words, Word, i);
 
         gint old_word_start = word->starting_doc;
-        gint old_word_end = word->starting_doc + word->word->len;
+        gint old_word_end = word->starting_doc + word->length;
 
         if (!word->valid_search) {
             continue;
@@ -240,7 +230,7 @@ void multicursor_add_word(ShortcutJump *sj, Word word) {
 
         if (new_word_start == old_word_start) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->length);
             word->valid_search = FALSE;
             return;
         }
@@ -251,9 +241,9 @@ void multicursor_add_word(ShortcutJump *sj, Word word) {
 
         if (old_enclosed_by_new || new_start_enclosed_by_old || new_end_enclosed_by_old) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting_doc, word->length);
             scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, multicursor_word.starting_doc,
-                                   multicursor_word.word->len);
+                                   multicursor_word.length);
             word->valid_search = FALSE;
         }
     }
@@ -283,7 +273,7 @@ void multicursor_toggle(ShortcutJump *sj) {
         for (gint i = 0; i < sj->multicursor_words->len; i++) {
             Word word = g_array_index(sj->multicursor_words, Word, i);
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.length);
         }
 
         if (sj->current_mode == JM_TRANSPOSE_MULTICURSOR) {
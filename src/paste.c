@@ -38,54 +38,10 @@ void paste_get_clipboard_text(ShortcutJump *sj) {
 }
 
 static void paste_insert_clipboard_text(ShortcutJump *sj) {
-    gint chars_added = 0;
-    gint c = -1;
-    gint prev;
     gint clipboard_text_len = strlen(sj->clipboard_text);
+    gint c = replace_insert_text(sj, sj->clipboard_text, clipboard_text_len);
 
     if (!sj->config_settings->disable_live_replace) {
-        scintilla_send_message(sj->sci, SCI_DELETERANGE, sj->first_position, sj->replace_cache->len);
-    }
-
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word *word = &g_array_index(sj->words, Word, i);
-
-        if (word->valid_search) {
-            gint v = chars_added + sj->cursor_moved_to_eol;
-
-            word->replace_pos += chars_added;
-            g_string_insert(sj->replace_cache, word->replace_pos + sj->replace_len, sj->clipboard_text);
-            chars_added += clipboard_text_len;
-
-            if (c == -1 && word->replace_pos + sj->first_position > v) {
-                c = prev;
-            } else {
-                prev = chars_added;
-            }
-        }
-    }
-
-    if (c == -1) {
-        c = chars_added;
-    }
-
-    if (!sj->config_settings->disable_live_replace) {
-        scintilla_send_message(sj->sci, SCI_INSERTTEXT, sj->first_position, (sptr_t)sj->replace_cache->str);
-
-        for (gint i = 0; i < sj->words->len; i++) {
-            Word word = g_array_index(sj->words, Word, i);
-
-            if (word.valid_search) {
-                gint start = sj->first_position + word.replace_pos;
-                gint len = sj->replace_len + clipboard_text_len;
-
-                scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
-                scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, start, len);
-            }
-        }
-
         sj->cursor_moved_to_eol += c;
     }
 
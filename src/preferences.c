@@ -75,6 +75,7 @@ void update_settings(SettingSource source, ShortcutJump *sj) {
     UPDATE_BOOL(shortcuts_include_single_char, "shortcuts_include_single_char", "shortcut");
     UPDATE_BOOL(hide_word_shortcut_jump, "hide_word_shortcut_jump", "shortcut");
     UPDATE_BOOL(center_shortcut, "center_shortcut", "shortcut");
+    UPDATE_BOOL(label_overlay, "label_overlay", "shortcut");
 
     UPDATE_BOOL(wrap_search, "wrap_search", "search");
     UPDATE_BOOL(search_start_from_beginning, "search_start_from_beginning", "search");
@@ -93,6 +94,7 @@ void update_settings(SettingSource source, ShortcutJump *sj) {
     UPDATE_INTEGER(text_after, "text_after", "text_after");
     UPDATE_INTEGER(line_after, "line_after", "line_after");
     UPDATE_INTEGER(replace_action, "replace_action", "replace_action");
+    UPDATE_INTEGER(target_styles, "target_styles", "target_styles");
 
     UPDATE_COLOR(text_color, "text_color", text_color_gdk);
     UPDATE_COLOR(search_annotation_bg_color, "search_annotation_bg_color", search_annotation_bg_color_gdk);
@@ -110,3 +112,55 @@ void update_settings(SettingSource source, ShortcutJump *sj) {
     g_free(config_dir);
     g_key_file_free(config);
 }
+
+void load_settings(ShortcutJump *sj, GKeyFile *config) {
+#define SET_SETTING_BOOL(name, name_str, category, default)                                                            \
+    G_STMT_START { sj->config_settings->name = utils_get_setting_boolean(config, category, name_str, default); }       \
+    G_STMT_END
+
+#define SET_SETTING_INTEGER(name, name_str, category, default)                                                         \
+    G_STMT_START { sj->config_settings->name = utils_get_setting_integer(config, category, name_str, default); }       \
+    G_STMT_END
+
+#define SET_SETTING_COLOR(name, name_str, default)                                                                     \
+    G_STMT_START { sj->config_settings->name = utils_get_setting_integer(config, "colors", name_str, default); }       \
+    G_STMT_END
+
+    SET_SETTING_BOOL(show_annotations, "show_annotations", "general", TRUE);
+    SET_SETTING_BOOL(use_selected_word_or_char, "use_selected_word_or_char", "general", TRUE);
+    SET_SETTING_BOOL(wait_for_enter, "wait_for_enter", "general", FALSE);
+    SET_SETTING_BOOL(only_tag_current_line, "only_tag_current_line", "general", FALSE);
+    SET_SETTING_BOOL(move_marker_to_line, "move_marker_to_line", "general", FALSE);
+    SET_SETTING_BOOL(cancel_on_mouse_move, "cancel_on_mouse_move", "general", FALSE);
+    SET_SETTING_BOOL(search_from_selection, "search_from_selection", "general", TRUE);
+    SET_SETTING_BOOL(search_selection_if_line, "search_selection_if_line", "general", TRUE);
+
+    SET_SETTING_BOOL(select_when_shortcut_char, "select_when_shortcut_char", "shortcut", TRUE);
+    SET_SETTING_BOOL(jump_on_single_instance, "jump_on_single_instance", "shortcut", FALSE);
+    SET_SETTING_BOOL(shortcut_all_caps, "shortcut_all_caps", "shortcut", FALSE);
+    SET_SETTING_BOOL(shortcuts_include_single_char, "shortcuts_include_single_char", "shortcut", FALSE);
+    SET_SETTING_BOOL(hide_word_shortcut_jump, "hide_word_shortcut_jump", "shortcut", FALSE);
+    SET_SETTING_BOOL(center_shortcut, "center_shortcut", "shortcut", FALSE);
+    SET_SETTING_BOOL(label_overlay, "label_overlay", "shortcut", FALSE);
+
+    SET_SETTING_BOOL(wrap_search, "wrap_search", "search", TRUE);
+    SET_SETTING_BOOL(search_start_from_beginning, "search_start_from_beginning", "search", TRUE);
+    SET_SETTING_BOOL(match_whole_word, "match_whole_word", "search", FALSE);
+    SET_SETTING_BOOL(search_case_sensitive, "search_case_sensitive", "search", TRUE);
+    SET_SETTING_BOOL(search_smart_case, "search_smart_case", "search", TRUE);
+
+    SET_SETTING_BOOL(instant_transpose, "instant_transpose", "action", FALSE);
+    SET_SETTING_BOOL(disable_live_replace, "disable_live_replace", "action", FALSE);
+
+    SET_SETTING_BOOL(whole_document, "search_whole_document", "document", TRUE);
+
+    SET_SETTING_INTEGER(text_after, "text_after", "text_after", TX_SELECT_TEXT);
+    SET_SETTING_INTEGER(line_after, "line_after", "line_after", LA_SELECT_TO_LINE);
+    SET_SETTING_INTEGER(replace_action, "replace_action", "replace_action", RA_REPLACE);
+    SET_SETTING_INTEGER(target_styles, "target_styles", "target_styles", TS_ALL);
+
+    SET_SETTING_COLOR(text_color, "text_color", 0xFFFFFF);
+    SET_SETTING_COLOR(search_annotation_bg_color, "search_annotation_bg_color", 0x46383D);
+    SET_SETTING_COLOR(tag_color, "tag_color", 0xFFFFFF);
+    SET_SETTING_COLOR(highlight_color, "highlight_color", 0x00FF00);
+}
@@ -22,5 +22,6 @@
 #include "jump_to_a_word.h"
 
 void update_settings(SettingSource source, ShortcutJump *sj);
+void load_settings(ShortcutJump *sj, GKeyFile *config);
 
 #endif
@@ -0,0 +1,77 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "prewarm.h"
+#include "util.h"
+#include "values.h"
+#include "view_cache.h"
+
+/*
+ * When the view scrolls or its text changes, the words of the range a word jump would take are found in an idle
+ * callback and put in the view cache, so the activation takes them instead of tokenizing the view again. The range
+ * follows the selection and current line rules of the activation; with whole document search the search reads the
+ * document index instead, and a word jump covers the same range either way.
+ */
+
+static gboolean prewarm_run(gpointer user_data) {
+    ShortcutJump *sj = (ShortcutJump *)user_data;
+    GeanyDocument *doc = document_get_current();
+
+    sj->prewarm_source_id = 0;
+
+    if (sj->current_mode != JM_NONE || sj->multicursor_mode != MC_DISABLED || !doc || !doc->is_valid) {
+        return G_SOURCE_REMOVE;
+    }
+
+    ScintillaObject *sci = doc->editor->sci;
+    gint first_position;
+    gint last_position;
+
+    sj->sci = sci;
+    get_view_range(sj, JM_SHORTCUT_WORD, &first_position, &last_position);
+
+    if (last_position <= first_position || view_cache_is_current(sj, sci, first_position, last_position)) {
+        return G_SOURCE_REMOVE;
+    }
+
+    const gchar *text = (const gchar *)scintilla_send_message(sci, SCI_GETRANGEPOINTER, first_position,
+                                                              last_position - first_position);
+
+    GArray *spans = g_array_new(FALSE, FALSE, sizeof(Span));
+
+    get_word_spans(sj, text, first_position, last_position, spans);
+    view_cache_store(sj, sci, first_position, last_position, spans);
+    g_array_free(spans, TRUE);
+
+    return G_SOURCE_REMOVE;
+}
+
+void prewarm_schedule(ShortcutJump *sj) {
+    if (!sj->prewarm_source_id) {
+        sj->prewarm_source_id = g_idle_add(prewarm_run, sj);
+    }
+}
+
+void prewarm_free(ShortcutJump *sj) {
+    if (sj->prewarm_source_id) {
+        g_source_remove(sj->prewarm_source_id);
+        sj->prewarm_source_id = 0;
+    }
+}
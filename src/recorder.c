@@ -0,0 +1,155 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "jump_to_a_word.h"
+#include "recorder.h"
+
+/*
+ * While recording is enabled, every activation is saved as a key file holding the document, view and selection it
+ * started from, the plugin settings in effect and the keys its handlers received. The bench replays these files
+ * through the same handlers with `--replay`. replace_instant_init runs the search inits itself, so those nested
+ * activations are folded into its recording.
+ */
+
+static gboolean enabled = FALSE;
+static GKeyFile *recording = NULL;
+static GArray *keyvals = NULL;
+static GArray *states = NULL;
+static GArray *delays = NULL;
+static gint64 last_key_time = 0;
+static guint sequence = 0;
+
+static void recorder_discard(void) {
+    if (!recording) {
+        return;
+    }
+
+    g_key_file_free(recording);
+    g_array_free(keyvals, TRUE);
+    g_array_free(states, TRUE);
+    g_array_free(delays, TRUE);
+
+    recording = NULL;
+}
+
+void recorder_begin_activation(ShortcutJump *sj, const gchar *mode, gint argument) {
+    if (sj->replace_instant) {
+        return;
+    }
+
+    recorder_discard();
+
+    if (!enabled) {
+        return;
+    }
+
+    ScintillaObject *sci = sj->sci;
+    gint selection_start = scintilla_send_message(sci, SCI_GETSELECTIONSTART, 0, 0);
+    gint selection_end = scintilla_send_message(sci, SCI_GETSELECTIONEND, 0, 0);
+    gint current_pos = scintilla_send_message(sci, SCI_GETCURRENTPOS, 0, 0);
+    gint length = scintilla_send_message(sci, SCI_GETLENGTH, 0, 0);
+    gchar *text = length > 0 ? sci_get_contents_range(sci, 0, length) : g_strdup("");
+
+    recording = g_key_file_new();
+    g_key_file_load_from_file(recording, sj->config_file, G_KEY_FILE_NONE, NULL);
+
+    g_key_file_set_string(recording, "recording", "mode", mode);
+    g_key_file_set_integer(recording, "recording", "argument", argument);
+    g_key_file_set_integer(recording, "recording", "first_visible_line",
+                           scintilla_send_message(sci, SCI_GETFIRSTVISIBLELINE, 0, 0));
+    g_key_file_set_integer(recording, "recording", "lines_on_screen",
+                           scintilla_send_message(sci, SCI_LINESONSCREEN, 0, 0));
+    g_key_file_set_integer(recording, "recording", "anchor",
+                           current_pos == selection_start ? selection_end : selection_start);
+    g_key_file_set_integer(recording, "recording", "current_pos", current_pos);
+    g_key_file_set_string(recording, "recording", "text", text);
+
+    g_free(text);
+
+    keyvals = g_array_new(FALSE, FALSE, sizeof(gint));
+    states = g_array_new(FALSE, FALSE, sizeof(gint));
+    delays = g_array_new(FALSE, FALSE, sizeof(gint));
+    last_key_time = g_get_monotonic_time();
+}
+
+void recorder_key(const GdkEventKey *event) {
+    if (!recording) {
+        return;
+    }
+
+    gint64 now = g_get_monotonic_time();
+    gint keyval = event->keyval;
+    gint state = event->state;
+    gint delay = (now - last_key_time) / 1000;
+
+    g_array_append_val(keyvals, keyval);
+    g_array_append_val(states, state);
+    g_array_append_val(delays, delay);
+
+    last_key_time = now;
+}
+
+void recorder_end_activation(ShortcutJump *sj) {
+    if (!recording) {
+        return;
+    }
+
+    gchar *dir = g_build_filename(sj->geany_data->app->configdir, "plugins", "jump-to-a-word", "recordings", NULL);
+    GDateTime *now = g_date_time_new_now_local();
+    gchar *stamp = g_date_time_format(now, "%Y%m%d-%H%M%S");
+    gchar *name = g_strdup_printf("%s-%03u.conf", stamp, ++sequence);
+    gchar *path = g_build_filename(dir, name, NULL);
+
+    g_key_file_set_integer_list(recording, "keys", "keyval", (gint *)keyvals->data, keyvals->len);
+    g_key_file_set_integer_list(recording, "keys", "state", (gint *)states->data, states->len);
+    g_key_file_set_integer_list(recording, "keys", "delay", (gint *)delays->data, delays->len);
+
+    if (!g_file_test(dir, G_FILE_TEST_IS_DIR) && utils_mkdir(dir, TRUE) != 0) {
+        ui_set_statusbar(TRUE, _("Recording directory could not be created."));
+    } else {
+        gchar *data = g_key_file_to_data(recording, NULL, NULL);
+
+        if (utils_write_file(path, data) == 0) {
+            ui_set_statusbar(TRUE, _("Recorded %u key%s to %s."), keyvals->len, keyvals->len == 1 ? "" : "s", path);
+        } else {
+            ui_set_statusbar(TRUE, _("Recording could not be written to %s."), path);
+        }
+
+        g_free(data);
+    }
+
+    g_free(path);
+    g_free(name);
+    g_free(stamp);
+    g_date_time_unref(now);
+    g_free(dir);
+
+    recorder_discard();
+}
+
+void recorder_menu_toggled(GtkCheckMenuItem *menu_item, gpointer user_data) {
+    enabled = gtk_check_menu_item_get_active(menu_item);
+
+    if (!enabled) {
+        recorder_discard();
+    }
+
+    ui_set_statusbar(TRUE, enabled ? _("Recording Jump to a Word activations.") : _("Recording stopped."));
+}
@@ -23,6 +23,7 @@
 #include "search_word.h"
 #include "selection.h"
 #include "shortcut_char.h"
+#include "style_filter.h"
 #include "util.h"
 #include "values.h"
 
@@ -38,10 +39,10 @@ static void replace(ShortcutJump *sj) {
             gint t = word->replace_pos;
 
             if (sj->previous_replace_action == RA_REPLACE) {
-                g_string_erase(sj->replace_cache, new_pos, word->word->len);
-                chars_removed += word->word->len;
+                g_string_erase(sj->replace_cache, new_pos, word->length);
+                chars_removed += word->length;
             } else if (sj->previous_replace_action == RA_INSERT_END) {
-                new_pos += word->word->len;
+                new_pos += word->length;
             }
 
             g_string_insert_len(sj->replace_cache, new_pos, sj->previous_replace_query->str,
@@ -90,6 +91,7 @@ static void repeat_action(gpointer user_data) {
 
     sj->replace_cache = g_string_new(screen_lines);
     sj->buffer = g_string_new(screen_lines);
+    set_line_starts(sj, sj->buffer->str, sj->buffer->len);
     sj->words = g_array_new(FALSE, FALSE, sizeof(Word));
     sj->search_query = g_string_new(sj->previous_search_query->str);
 
@@ -104,7 +106,7 @@ static void repeat_action(gpointer user_data) {
                          sj->search_query->str, sj->previous_replace_query->str);
     } else if (sj->previous_mode == JM_SHORTCUT_CHAR_REPLACING) {
         sj->lf_positions = g_array_new(FALSE, FALSE, sizeof(Word));
-        shortcut_char_get_chars(sj, sj->search_query->str[0]);
+        shortcut_char_get_chars(sj, g_utf8_get_char(sj->search_query->str));
         scintilla_send_message(sj->sci, SCI_BEGINUNDOACTION, 0, 0);
         replace(sj);
         scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
@@ -121,15 +123,12 @@ static void repeat_action(gpointer user_data) {
                          sj->search_query->str, sj->previous_replace_query->str);
     }
 
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        g_string_free(word.word, TRUE);
-    }
-
     g_string_free(sj->replace_cache, TRUE);
     g_string_free(sj->buffer, TRUE);
     g_array_free(sj->words, TRUE);
     g_string_free(sj->search_query, TRUE);
+    clear_line_starts(sj);
+    style_filter_clear(sj);
 }
 
 gboolean repeat_action_kb(GeanyKeyBinding *kb, guint key_id, gpointer user_data) {
@@ -19,159 +19,139 @@
 #include <plugindata.h>
 
 #include "annotation.h"
+#include "core/replace_cache.h"
 #include "jump_to_a_word.h"
+#include "latency.h"
 
-void clear_occurrences(ShortcutJump *sj) {
-    gint chars_removed = 0;
-    gint removed_to_left = 0;
-
-    if (!sj->config_settings->disable_live_replace) {
-        scintilla_send_message(sj->sci, SCI_DELETERANGE, sj->first_position, sj->replace_cache->len);
-    }
+static GArray *replace_get_spans(ShortcutJump *sj) {
+    GArray *spans = g_array_new(FALSE, FALSE, sizeof(Span));
 
     for (gint i = 0; i < sj->words->len; i++) {
-        Word *word = &g_array_index(sj->words, Word, i);
+        const Word *word = &g_array_index(sj->words, Word, i);
 
         if (word->valid_search) {
-            word->replace_pos -= chars_removed;
-            g_string_erase(sj->replace_cache, word->replace_pos, word->word->len);
-            chars_removed += word->word->len;
-
-            if (word->starting_doc < sj->cursor_moved_to_eol) {
-                removed_to_left = chars_removed;
-            }
+            Span span = {word->replace_pos, word->length};
+            g_array_append_val(spans, span);
         }
     }
 
-    if (!sj->config_settings->disable_live_replace) {
-        scintilla_send_message(sj->sci, SCI_INSERTTEXT, sj->first_position, (sptr_t)sj->replace_cache->str);
+    return spans;
+}
 
-        sj->current_cursor_pos -= removed_to_left;
-        sj->cursor_moved_to_eol -= removed_to_left;
+static void replace_set_spans(ShortcutJump *sj, GArray *spans) {
+    gint j = 0;
+
+    for (gint i = 0; i < sj->words->len; i++) {
+        Word *word = &g_array_index(sj->words, Word, i);
+
+        if (word->valid_search) {
+            word->replace_pos = g_array_index(spans, Span, j++).position;
+        }
     }
 
-    scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->cursor_moved_to_eol, 0);
+    g_array_free(spans, TRUE);
 }
 
-static void add_character(ShortcutJump *sj, gunichar keychar) {
-    gint chars_added = 0;
+static gint replace_chars_before_cursor(ShortcutJump *sj, GArray *spans, gint step) {
     gint c = -1;
-    gint prev;
+    gint prev = 0;
 
-    if (!sj->config_settings->disable_live_replace) {
-        scintilla_send_message(sj->sci, SCI_DELETERANGE, sj->first_position, sj->replace_cache->len);
+    for (gint i = 0; i < spans->len; i++) {
+        gint v = sj->cursor_moved_to_eol + i * step;
+
+        if (c == -1 && g_array_index(spans, Span, i).position + sj->first_position > v) {
+            c = prev;
+        } else {
+            prev = (i + 1) * ABS(step);
+        }
     }
 
+    return c == -1 ? spans->len * ABS(step) : c;
+}
+
+static void replace_mark_range(ShortcutJump *sj, gint len) {
     for (gint i = 0; i < sj->words->len; i++) {
-        Word *word = &g_array_index(sj->words, Word, i);
+        const Word *word = &g_array_index(sj->words, Word, i);
 
         if (word->valid_search) {
-            gint v = chars_added + sj->cursor_moved_to_eol;
+            gint start = sj->first_position + word->replace_pos;
 
-            word->replace_pos += chars_added;
-            g_string_insert_c(sj->replace_cache, word->replace_pos + sj->replace_len, keychar);
-            chars_added += 1;
-
-            if (c == -1 && word->replace_pos + sj->first_position > v) {
-                c = prev;
-            } else {
-                prev = chars_added;
-            }
+            scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
+            scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, start, len);
         }
     }
+}
 
-    if (c == -1) {
-        c = chars_added;
-    }
+gint replace_insert_text(ShortcutJump *sj, const gchar *text, gint length) {
+    GArray *spans = replace_get_spans(sj);
 
     if (!sj->config_settings->disable_live_replace) {
-        scintilla_send_message(sj->sci, SCI_INSERTTEXT, sj->first_position, (sptr_t)sj->replace_cache->str);
+        scintilla_send_message(sj->sci, SCI_DELETERANGE, sj->first_position, sj->replace_cache->len);
+    }
 
-        for (gint i = 0; i < sj->words->len; i++) {
-            Word word = g_array_index(sj->words, Word, i);
+    replace_cache_insert(sj->replace_cache, spans, sj->replace_len, text, length);
 
-            if (word.valid_search) {
-                gint start = sj->first_position + word.replace_pos;
-                gint len = sj->replace_len + 1;
+    gint c = replace_chars_before_cursor(sj, spans, length);
 
-                scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
-                scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, start, len);
-            }
-        }
+    replace_set_spans(sj, spans);
 
-        sj->current_cursor_pos += c;
-        sj->cursor_moved_to_eol += c;
+    if (!sj->config_settings->disable_live_replace) {
+        scintilla_send_message(sj->sci, SCI_INSERTTEXT, sj->first_position, (sptr_t)sj->replace_cache->str);
+        replace_mark_range(sj, sj->replace_len + length);
     }
 
-    scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->cursor_moved_to_eol, 0);
-
-    g_string_insert_c(sj->replace_query, sj->replace_len, keychar);
-    sj->replace_len += 1;
-    sj->search_change_made = TRUE;
-
-    if (sj->config_settings->disable_live_replace) {
-        annotation_display_replace_string(sj);
-    }
+    return c;
 }
 
-static void backspace_character(ShortcutJump *sj) {
+void clear_occurrences(ShortcutJump *sj) {
+    GArray *spans = replace_get_spans(sj);
     gint chars_removed = 0;
-    gint c = -1;
-    gint prev;
+    gint removed_to_left = 0;
 
     if (!sj->config_settings->disable_live_replace) {
         scintilla_send_message(sj->sci, SCI_DELETERANGE, sj->first_position, sj->replace_cache->len);
     }
 
     for (gint i = 0; i < sj->words->len; i++) {
-        Word *word = &g_array_index(sj->words, Word, i);
-
-        if (word->valid_search) {
-            gint v = sj->cursor_moved_to_eol - chars_removed;
+        Word word = g_array_index(sj->words, Word, i);
 
-            g_string_erase(sj->replace_cache, word->replace_pos - chars_removed + sj->replace_len - 1, 1);
-            word->replace_pos -= chars_removed;
-            chars_removed += 1;
+        if (word.valid_search) {
+            chars_removed += word.length;
 
-            if (c == -1 && word->replace_pos + sj->first_position > v) {
-                c = prev;
-            } else {
-                prev = chars_removed;
+            if (word.starting_doc < sj->cursor_moved_to_eol) {
+                removed_to_left = chars_removed;
             }
         }
     }
 
-    if (c == -1) {
-        c = chars_removed;
-    }
+    replace_cache_erase_spans(sj->replace_cache, spans);
+    replace_set_spans(sj, spans);
 
     if (!sj->config_settings->disable_live_replace) {
         scintilla_send_message(sj->sci, SCI_INSERTTEXT, sj->first_position, (sptr_t)sj->replace_cache->str);
 
-        for (gint i = 0; i < sj->words->len; i++) {
-            Word word = g_array_index(sj->words, Word, i);
+        sj->current_cursor_pos -= removed_to_left;
+        sj->cursor_moved_to_eol -= removed_to_left;
+    }
 
-            if (word.valid_search) {
-                gint start = sj->first_position + word.replace_pos;
-                gint len = sj->replace_len - 1;
+    scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->cursor_moved_to_eol, 0);
+}
 
-                scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
-                scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, start, len);
-            }
-        }
+static void add_character(ShortcutJump *sj, gunichar keychar) {
+    gchar ch = keychar;
+    gint c = replace_insert_text(sj, &ch, 1);
 
-        sj->current_cursor_pos -= c;
-        sj->cursor_moved_to_eol -= c;
+    if (!sj->config_settings->disable_live_replace) {
+        sj->current_cursor_pos += c;
+        sj->cursor_moved_to_eol += c;
     }
 
     scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->cursor_moved_to_eol, 0);
 
-    sj->replace_len -= 1;
-    g_string_erase(sj->replace_query, sj->replace_len, 1);
+    g_string_insert_c(sj->replace_query, sj->replace_len, keychar);
+    sj->replace_len += 1;
     sj->search_change_made = TRUE;
 
     if (sj->config_settings->disable_live_replace) {
@@ -179,65 +159,52 @@ static void backspace_character(ShortcutJump *sj) {
     }
 }
 
-static gboolean delete_character(ShortcutJump *sj) {
-    gint chars_removed = 0;
-    gint c = -1;
-    gint prev;
+static gboolean remove_character(ShortcutJump *sj, gint offset, gint marked_length) {
+    GArray *spans = replace_get_spans(sj);
+    gint cache_len = sj->replace_cache->len;
+
+    if (!replace_cache_erase(sj->replace_cache, spans, offset, 1)) {
+        g_array_free(spans, TRUE);
+        return FALSE;
+    }
 
     if (!sj->config_settings->disable_live_replace) {
-        scintilla_send_message(sj->sci, SCI_DELETERANGE, sj->first_position, sj->replace_cache->len);
+        scintilla_send_message(sj->sci, SCI_DELETERANGE, sj->first_position, cache_len);
     }
 
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word *word = &g_array_index(sj->words, Word, i);
+    gint c = replace_chars_before_cursor(sj, spans, -1);
 
-        if (word->valid_search) {
-            gint v = sj->cursor_moved_to_eol - chars_removed;
-            gint p = word->replace_pos + sj->replace_len - chars_removed;
+    replace_set_spans(sj, spans);
 
-            if (p < sj->replace_cache->len) {
-                g_string_erase(sj->replace_cache, p, 1);
-            } else {
-                return TRUE;
-            }
-
-            word->replace_pos -= chars_removed;
-            chars_removed += 1;
-
-            if (c == -1 && word->replace_pos + sj->first_position > v) {
-                c = prev;
-            } else {
-                prev = chars_removed;
-            }
-        }
-    }
+    if (!sj->config_settings->disable_live_replace) {
+        scintilla_send_message(sj->sci, SCI_INSERTTEXT, sj->first_position, (sptr_t)sj->replace_cache->str);
+        replace_mark_range(sj, marked_length);
 
-    if (c == -1) {
-        c = chars_removed;
+        sj->current_cursor_pos -= c;
+        sj->cursor_moved_to_eol -= c;
     }
 
-    if (!sj->config_settings->disable_live_replace) {
-        scintilla_send_message(sj->sci, SCI_INSERTTEXT, sj->first_position, (sptr_t)sj->replace_cache->str);
+    scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->cursor_moved_to_eol, 0);
 
-        for (gint i = 0; i < sj->words->len; i++) {
-            Word word = g_array_index(sj->words, Word, i);
+    return TRUE;
+}
 
-            if (word.valid_search) {
-                gint start = sj->first_position + word.replace_pos;
-                gint len = sj->replace_len;
+static void backspace_character(ShortcutJump *sj) {
+    remove_character(sj, sj->replace_len - 1, sj->replace_len - 1);
 
-                scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
-                scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, start, len);
-            }
-        }
+    sj->replace_len -= 1;
+    g_string_erase(sj->replace_query, sj->replace_len, 1);
+    sj->search_change_made = TRUE;
 
-        sj->current_cursor_pos -= c;
-        sj->cursor_moved_to_eol -= c;
+    if (sj->config_settings->disable_live_replace) {
+        annotation_display_replace_string(sj);
     }
+}
 
-    scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->cursor_moved_to_eol, 0);
+static gboolean delete_character(ShortcutJump *sj) {
+    if (!remove_character(sj, sj->replace_len, sj->replace_len)) {
+        return TRUE;
+    }
 
     sj->search_change_made = TRUE;
 
@@ -250,6 +217,8 @@ static gboolean delete_character(ShortcutJump *sj) {
 
 gboolean replace_handle_input(ShortcutJump *sj, GdkEventKey *event, gunichar keychar,
                               void complete_func(ShortcutJump *), void cancel_func(ShortcutJump *)) {
+    latency_begin(LATENCY_REPLACE, event);
+
     if (keychar != 0) {
         if (event->keyval == GDK_KEY_BackSpace) {
             if (sj->search_change_made) {
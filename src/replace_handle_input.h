@@ -21,6 +21,7 @@
 
 #include "jump_to_a_word.h"
 
+gint replace_insert_text(ShortcutJump *sj, const gchar *text, gint length);
 void clear_occurrences(ShortcutJump *sj);
 gboolean replace_handle_input(ShortcutJump *sj, GdkEventKey *event, gunichar keychar,
                               void complete_func(ShortcutJump *), void cancel_func(ShortcutJump *));
@@ -19,15 +19,18 @@
 #include <plugindata.h>
 
 #include "annotation.h"
+#include "document_index.h"
 #include "insert_line.h"
 #include "jump_to_a_word.h"
 #include "multicursor.h"
 #include "paste.h"
+#include "recorder.h"
 #include "replace_handle_input.h"
 #include "search_substring.h"
 #include "search_word.h"
 #include "selection.h"
 #include "shortcut_char.h"
+#include "trace.h"
 #include "util.h"
 #include "values.h"
 
@@ -35,6 +38,9 @@ gboolean on_key_press_search_replace(GtkWidget *widget, GdkEventKey *event, gpoi
     ShortcutJump *sj = (ShortcutJump *)user_data;
     gunichar keychar = gdk_keyval_to_unicode(event->keyval);
 
+    sci_stats_begin_keystroke();
+    recorder_key(event);
+
     annotation_clear(sj->sci, sj->eol_message_line);
     annotation_clear(sj->sci, sj->multicusor_eol_message_line);
 
@@ -129,12 +135,12 @@ void multicursor_replace(ShortcutJump *sj) {
             word->replace_pos = word->starting_doc - sj->first_position;
 
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting_doc, word->word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting_doc, word->length);
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting_doc, word->word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting_doc, word->length);
 
             if (sj->config_settings->replace_action == RA_INSERT_END) {
-                word->replace_pos += word->word->len;
+                word->replace_pos += word->length;
             }
 
             sj->search_results_count++;
@@ -218,6 +224,8 @@ void replace_substring_init(ShortcutJump *sj) {
 }
 
 void replace_word_init(ShortcutJump *sj) {
+    document_index_complete(sj);
+
     if (sj->search_results_count == 0) {
         ui_set_statusbar(TRUE, _("No words to replace."));
         search_word_jump_cancel(sj);
@@ -233,7 +241,7 @@ void replace_word_init(ShortcutJump *sj) {
         for (gint i = 0; i < sj->words->len; i++) {
             Word *word = &g_array_index(sj->words, Word, i);
             if (word->valid_search) {
-                word->replace_pos += word->word->len;
+                word->replace_pos += word->length;
             }
         }
     }
@@ -247,7 +255,12 @@ void replace_word_init(ShortcutJump *sj) {
 }
 
 void replace_instant_init(ShortcutJump *sj) {
+    sci_stats_begin_activation();
+    trace_begin_activation();
+    alloc_stats_begin_activation();
+    edit_stats_begin_activation();
     sj->sci = get_scintilla_object();
+    recorder_begin_activation(sj, "replace_instant", 0);
     set_selection_info(sj);
     sj->current_cursor_pos = scintilla_send_message(sj->sci, SCI_GETCURRENTPOS, 0, 0);
     sj->replace_instant = TRUE;
@@ -257,7 +270,8 @@ void replace_instant_init(ShortcutJump *sj) {
 
     if (sj->in_selection) {
         if (sj->selection_is_a_char) {
-            gchar query = scintilla_send_message(sj->sci, SCI_GETCHARAT, sj->selection_start, 0);
+            gint width;
+            gunichar query = get_char_at(sj->sci, sj->selection_start, &width);
             shortcut_char_init_with_query(sj, query);
             replace_shortcut_char_init(sj);
         } else {
@@ -0,0 +1,242 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "sci_stats.h"
+
+#ifdef SCI_STATS
+
+/*
+ * Counts every Scintilla round trip the plugin makes between a mode's init and its end. The wrapper macros in
+ * sci_stats.h route calls here; the parenthesized names below bypass them to reach Geany.
+ */
+
+#define SCI_STATS_CONTENTS_RANGE 0
+#define SCI_STATS_NAME(message) {message, #message}
+
+typedef struct {
+    guint message;
+    const gchar *name;
+} MessageName;
+
+typedef struct {
+    guint message;
+    guint count;
+} MessageCount;
+
+static const MessageName message_names[] = {
+    {SCI_STATS_CONTENTS_RANGE, "sci_get_contents_range"},
+    SCI_STATS_NAME(SCI_BEGINUNDOACTION),
+    SCI_STATS_NAME(SCI_CHANGEINSERTION),
+    SCI_STATS_NAME(SCI_DELETERANGE),
+    SCI_STATS_NAME(SCI_DOCLINEFROMVISIBLE),
+    SCI_STATS_NAME(SCI_ENDUNDOACTION),
+    SCI_STATS_NAME(SCI_EOLANNOTATIONCLEARALL),
+    SCI_STATS_NAME(SCI_EOLANNOTATIONSETSTYLEOFFSET),
+    SCI_STATS_NAME(SCI_EOLANNOTATIONSETTEXT),
+    SCI_STATS_NAME(SCI_EOLANNOTATIONSETVISIBLE),
+    SCI_STATS_NAME(SCI_GETCHARACTERPOINTER),
+    SCI_STATS_NAME(SCI_GETCHARAT),
+    SCI_STATS_NAME(SCI_GETCURRENTPOS),
+    SCI_STATS_NAME(SCI_GETFIRSTVISIBLELINE),
+    SCI_STATS_NAME(SCI_GETLENGTH),
+    SCI_STATS_NAME(SCI_GETLINECOUNT),
+    SCI_STATS_NAME(SCI_GETLINEENDPOSITION),
+    SCI_STATS_NAME(SCI_GETRANGEPOINTER),
+    SCI_STATS_NAME(SCI_GETSELECTIONEND),
+    SCI_STATS_NAME(SCI_GETSELECTIONSTART),
+    SCI_STATS_NAME(SCI_GETWORDCHARS),
+    SCI_STATS_NAME(SCI_GOTOPOS),
+    SCI_STATS_NAME(SCI_INDICATORCLEARRANGE),
+    SCI_STATS_NAME(SCI_INDICATORFILLRANGE),
+    SCI_STATS_NAME(SCI_INDICSETALPHA),
+    SCI_STATS_NAME(SCI_INDICSETFORE),
+    SCI_STATS_NAME(SCI_INDICSETOUTLINEALPHA),
+    SCI_STATS_NAME(SCI_INDICSETSTYLE),
+    SCI_STATS_NAME(SCI_INSERTTEXT),
+    SCI_STATS_NAME(SCI_LINEFROMPOSITION),
+    SCI_STATS_NAME(SCI_LINELENGTH),
+    SCI_STATS_NAME(SCI_LINESONSCREEN),
+    SCI_STATS_NAME(SCI_MARKERADD),
+    SCI_STATS_NAME(SCI_MARKERADDSET),
+    SCI_STATS_NAME(SCI_MARKERDEFINE),
+    SCI_STATS_NAME(SCI_MARKERDELETE),
+    SCI_STATS_NAME(SCI_MARKERGET),
+    SCI_STATS_NAME(SCI_POSITIONFROMLINE),
+    SCI_STATS_NAME(SCI_RELEASEALLEXTENDEDSTYLES),
+    SCI_STATS_NAME(SCI_REPLACETARGET),
+    SCI_STATS_NAME(SCI_SETCURRENTPOS),
+    SCI_STATS_NAME(SCI_SETFIRSTVISIBLELINE),
+    SCI_STATS_NAME(SCI_SETINDICATORCURRENT),
+    SCI_STATS_NAME(SCI_SETREADONLY),
+    SCI_STATS_NAME(SCI_SETSEL),
+    SCI_STATS_NAME(SCI_SETTARGETEND),
+    SCI_STATS_NAME(SCI_SETTARGETSTART),
+    SCI_STATS_NAME(SCI_STYLESETBACK),
+    SCI_STATS_NAME(SCI_STYLESETFORE),
+    SCI_STATS_NAME(SCI_UNDO),
+    SCI_STATS_NAME(SCI_WORDENDPOSITION),
+    SCI_STATS_NAME(SCI_WORDSTARTPOSITION),
+    SCI_STATS_NAME(SCI_WRAPCOUNT),
+};
+
+static GHashTable *counts = NULL;
+static gboolean active = FALSE;
+static gboolean in_keystroke = FALSE;
+static guint total = 0;
+static guint activation_total = 0;
+static guint keystrokes = 0;
+static guint keystroke_total = 0;
+static guint keystroke_max = 0;
+static guint keystroke_current = 0;
+
+static void sci_stats_count(guint message) {
+    guint count = GPOINTER_TO_UINT(g_hash_table_lookup(counts, GUINT_TO_POINTER(message)));
+
+    g_hash_table_insert(counts, GUINT_TO_POINTER(message), GUINT_TO_POINTER(count + 1));
+
+    total++;
+
+    if (in_keystroke) {
+        keystroke_current++;
+    } else {
+        activation_total++;
+    }
+}
+
+static void sci_stats_end_keystroke(void) {
+    if (!in_keystroke) {
+        return;
+    }
+
+    keystroke_total += keystroke_current;
+    keystroke_max = MAX(keystroke_max, keystroke_current);
+    keystroke_current = 0;
+    in_keystroke = FALSE;
+}
+
+static void sci_stats_reset(void) {
+    if (counts) {
+        g_hash_table_remove_all(counts);
+    }
+
+    in_keystroke = FALSE;
+    total = 0;
+    activation_total = 0;
+    keystrokes = 0;
+    keystroke_total = 0;
+    keystroke_max = 0;
+    keystroke_current = 0;
+}
+
+static const gchar *sci_stats_message_name(guint message) {
+    for (gint i = 0; i < G_N_ELEMENTS(message_names); i++) {
+        if (message_names[i].message == message) {
+            return message_names[i].name;
+        }
+    }
+
+    return NULL;
+}
+
+static gint sci_stats_sort_by_count(gconstpointer a, gconstpointer b) {
+    const MessageCount *count_a = (const MessageCount *)a;
+    const MessageCount *count_b = (const MessageCount *)b;
+
+    if (count_a->count != count_b->count) {
+        return count_a->count < count_b->count ? 1 : -1;
+    }
+
+    return count_a->message < count_b->message ? -1 : count_a->message > count_b->message;
+}
+
+static void sci_stats_collect(gpointer key, gpointer value, gpointer user_data) {
+    MessageCount count = {GPOINTER_TO_UINT(key), GPOINTER_TO_UINT(value)};
+
+    g_array_append_val((GArray *)user_data, count);
+}
+
+sptr_t sci_stats_send_message(ScintillaObject *sci, unsigned int message, uptr_t wparam, sptr_t lparam) {
+    if (active) {
+        sci_stats_count(message);
+    }
+
+    return (scintilla_send_message)(sci, message, wparam, lparam);
+}
+
+gchar *sci_stats_get_contents_range(ScintillaObject *sci, gint start, gint end) {
+    if (active) {
+        sci_stats_count(SCI_STATS_CONTENTS_RANGE);
+    }
+
+    return (sci_get_contents_range)(sci, start, end);
+}
+
+void sci_stats_begin_activation(void) {
+    if (!counts) {
+        counts = g_hash_table_new(g_direct_hash, g_direct_equal);
+    }
+
+    sci_stats_reset();
+    active = TRUE;
+}
+
+void sci_stats_begin_keystroke(void) {
+    if (!active) {
+        return;
+    }
+
+    sci_stats_end_keystroke();
+    keystrokes++;
+    in_keystroke = TRUE;
+}
+
+void sci_stats_report(const gchar *mode) {
+    if (!active) {
+        return;
+    }
+
+    sci_stats_end_keystroke();
+
+    msgwin_status_add(_("%s: %u Scintilla messages (%u on activation, %u over %u keystroke%s, max %u)."), mode, total,
+                      activation_total, keystroke_total, keystrokes, keystrokes == 1 ? "" : "s", keystroke_max);
+
+    GArray *sorted = g_array_new(FALSE, FALSE, sizeof(MessageCount));
+
+    g_hash_table_foreach(counts, sci_stats_collect, sorted);
+    g_array_sort(sorted, sci_stats_sort_by_count);
+
+    for (gint i = 0; i < sorted->len; i++) {
+        MessageCount count = g_array_index(sorted, MessageCount, i);
+        const gchar *name = sci_stats_message_name(count.message);
+
+        if (name) {
+            g_debug("%s: %s %u", mode, name, count.count);
+        } else {
+            g_debug("%s: message %u %u", mode, count.message, count.count);
+        }
+    }
+
+    g_array_free(sorted, TRUE);
+
+    sci_stats_reset();
+    active = FALSE;
+}
+
+#endif
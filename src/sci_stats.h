@@ -0,0 +1,43 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCI_STATS_H_
+#define SCI_STATS_H_
+
+#include <geanyplugin.h>
+
+#ifdef SCI_STATS
+
+#define scintilla_send_message(sci, message, wparam, lparam) sci_stats_send_message(sci, message, wparam, lparam)
+#define sci_get_contents_range(sci, start, end) sci_stats_get_contents_range(sci, start, end)
+
+sptr_t sci_stats_send_message(ScintillaObject *sci, unsigned int message, uptr_t wparam, sptr_t lparam);
+gchar *sci_stats_get_contents_range(ScintillaObject *sci, gint start, gint end);
+void sci_stats_begin_activation(void);
+void sci_stats_begin_keystroke(void);
+void sci_stats_report(const gchar *mode);
+
+#else
+
+#define sci_stats_begin_activation()
+#define sci_stats_begin_keystroke()
+#define sci_stats_report(mode)
+
+#endif
+
+#endif
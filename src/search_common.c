@@ -23,14 +23,6 @@
 #include "search_word.h"
 #include "util.h"
 
-gboolean valid_smart_case(char haystack_char, char needle_char) {
-    gboolean g1 = g_unichar_islower(haystack_char) && g_unichar_islower(needle_char) && needle_char == haystack_char;
-    gboolean g2 = g_unichar_isupper(haystack_char) && g_unichar_islower(needle_char) &&
-                  g_ascii_tolower(haystack_char) == needle_char;
-    gboolean g3 = g_unichar_isupper(haystack_char) && g_unichar_isupper(needle_char) && needle_char == haystack_char;
-    return g1 || g2 || g3 || haystack_char == needle_char;
-}
-
 gint get_search_word_pos(ShortcutJump *sj) {
     gint closest_to_left = 0;
     gint closest_to_right = 0;
@@ -38,19 +30,19 @@ gint get_search_word_pos(ShortcutJump *sj) {
     gint closest_to_right_idx = -1;
     gint left_len = 0;
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search && word.starting >= sj->current_cursor_pos) {
-            closest_to_right = word.starting;
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (word->valid_search && word->starting >= sj->current_cursor_pos) {
+            closest_to_right = word->starting;
             closest_to_right_idx = i;
             break;
         }
     }
     for (gint i = sj->words->len - 1; i >= 0; i--) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search && word.starting < sj->current_cursor_pos) {
-            closest_to_left = word.starting;
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (word->valid_search && word->starting < sj->current_cursor_pos) {
+            closest_to_left = word->starting;
             closest_to_left_idx = i;
-            left_len = word.word->len;
+            left_len = word->length;
             break;
         }
     }
@@ -63,8 +55,8 @@ gint get_search_word_pos(ShortcutJump *sj) {
 
 gint get_search_word_pos_first(ShortcutJump *sj) {
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (word->valid_search) {
             return i;
         }
     }
@@ -73,8 +65,8 @@ gint get_search_word_pos_first(ShortcutJump *sj) {
 
 gint get_search_word_pos_last(ShortcutJump *sj) {
     for (gint i = sj->words->len - 1; i >= 0; i--) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (word->valid_search) {
             return i;
         }
     }
@@ -83,15 +75,15 @@ gint get_search_word_pos_last(ShortcutJump *sj) {
 
 gboolean set_search_word_pos_right_key(ShortcutJump *sj) {
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (sj->search_word_pos == sj->search_word_pos_last && word.valid_search && sj->config_settings->wrap_search) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (sj->search_word_pos == sj->search_word_pos_last && word->valid_search && sj->config_settings->wrap_search) {
             sj->search_word_pos = sj->search_word_pos_first;
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting, word->length);
             return TRUE;
         }
-        if (i > sj->search_word_pos && word.valid_search) {
+        if (i > sj->search_word_pos && word->valid_search) {
             sj->search_word_pos = i;
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting, word->length);
             return TRUE;
         }
     }
@@ -100,15 +92,16 @@ gboolean set_search_word_pos_right_key(ShortcutJump *sj) {
 
 gboolean set_search_word_pos_left_key(ShortcutJump *sj) {
     for (gint i = sj->words->len - 1; i >= 0; i--) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (sj->search_word_pos == sj->search_word_pos_first && word.valid_search && sj->config_settings->wrap_search) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (sj->search_word_pos == sj->search_word_pos_first && word->valid_search &&
+            sj->config_settings->wrap_search) {
             sj->search_word_pos = i;
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting, word->length);
             return TRUE;
         }
-        if (i < sj->search_word_pos && word.valid_search) {
+        if (i < sj->search_word_pos && word->valid_search) {
             sj->search_word_pos = i;
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting, word->length);
             return TRUE;
         }
     }
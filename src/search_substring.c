@@ -20,19 +20,24 @@
 
 #include "action_text_after.h"
 #include "annotation.h"
+#include "core/match.h"
 #include "jump_to_a_word.h"
+#include "latency.h"
 #include "multicursor.h"
 #include "paste.h"
+#include "recorder.h"
 #include "search_common.h"
 #include "selection.h"
+#include "style_filter.h"
+#include "trace.h"
 #include "transpose_string.h"
 #include "util.h"
 #include "values.h"
 
 static void search_substring_clear_replace_indicators(ShortcutJump *sj) {
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        gint start = sj->first_position + word.replace_pos;
+        const Word *word = &g_array_index(sj->words, Word, i);
+        gint start = sj->first_position + word->replace_pos;
         gint len = sj->replace_len;
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
         scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
@@ -45,21 +50,20 @@ static void search_substring_clear_replace_indicators(ShortcutJump *sj) {
 
 static void search_substring_clear_jump_indicators(ShortcutJump *sj) {
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
+        const Word *word = &g_array_index(sj->words, Word, i);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
     }
 }
 
 void search_substring_end(ShortcutJump *sj) {
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        g_string_free(word.word, TRUE);
-    }
+    sci_stats_report(_("Substring search"));
+    edit_stats_report(_("Substring search"));
+    recorder_end_activation(sj);
 
     free_sj_values(sj);
 
@@ -118,11 +122,11 @@ static void search_substring_jump_complete(ShortcutJump *sj) {
 
     if (sj->multicursor_mode == MC_ACCEPTING) {
         for (gint i = 0; i < sj->words->len; i++) {
-            Word word = g_array_index(sj->words, Word, i);
-            if (word.valid_search) {
+            const Word *word = &g_array_index(sj->words, Word, i);
+            if (word->valid_search) {
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting_doc, word.word->len);
-                multicursor_add_word(sj, word);
+                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting_doc, word->length);
+                multicursor_add_word(sj, *word);
             }
         }
     }
@@ -130,7 +134,7 @@ static void search_substring_jump_complete(ShortcutJump *sj) {
     Word word = g_array_index(sj->words, Word, sj->search_word_pos);
     gint pos = word.starting;
     gint line = word.line;
-    gint word_length = word.word->len;
+    gint word_length = word.length;
 
     sj->previous_cursor_pos = sj->current_cursor_pos;
     scintilla_send_message(sj->sci, SCI_GOTOPOS, word.starting, 0);
@@ -193,17 +197,17 @@ void search_substring_set_query(ShortcutJump *sj) {
     g_string_append(sj->search_query, sci_get_contents_range(sj->sci, sj->selection_start, sj->selection_end));
 }
 
-static Word search_substring_make_word(ShortcutJump *sj, gint i) {
+static Word search_substring_make_word(ShortcutJump *sj, gint i, gint line) {
     Word data;
     gint start = sj->first_position + i;
-    gint end = sj->first_position + i + sj->search_query->len;
-    data.word = g_string_new(sci_get_contents_range(sj->sci, start, end));
+    data.length = sj->search_query->len;
     data.starting = start;
     data.starting_doc = start;
     data.replace_pos = i;
-    data.line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, start, 0);
+    data.line = line;
     data.valid_search = TRUE;
-    data.shortcut = NULL;
+    data.shortcut[0] = '\0';
+    data.shortcut_length = 0;
     data.padding = 0;
     data.bytes = 0;
     data.shortcut_marked = FALSE;
@@ -212,89 +216,57 @@ static Word search_substring_make_word(ShortcutJump *sj, gint i) {
 }
 
 void search_substring_get_substrings(ShortcutJump *sj) {
+    gint64 trace_start = trace_now();
+
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
+        const Word *word = &g_array_index(sj->words, Word, i);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
-        g_string_free(word.word, TRUE);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
     }
 
     g_array_set_size(sj->words, 0);
     sj->search_results_count = 0;
 
-    if (sj->config_settings->search_case_sensitive && !sj->config_settings->search_smart_case) {
-        gchar *b = sj->buffer->str;
-        gchar *z = g_strstr_len(b, -1, sj->search_query->str);
-
-        while (z) {
-            gint i = z - sj->buffer->str;
-            Word data = search_substring_make_word(sj, i);
-
-            g_array_append_val(sj->words, data);
-            sj->search_results_count += 1;
-            b = z + sj->search_query->len;
-            z = g_strstr_len(b, -1, sj->search_query->str);
-        }
-    } else if (sj->config_settings->search_case_sensitive && sj->config_settings->search_smart_case) {
-        gint i = 0;
-
-        for (gchar *p = sj->buffer->str; *p != '\0'; p++) {
-            const gchar *z;
-            gint k = 0;
-            gchar haystack_char;
-            gchar needle_char;
-
-            do {
-                const gchar *d = p + k;
-
-                z = sj->search_query->str + k;
+    MatchOptions options = {
+        .case_sensitive = sj->config_settings->search_case_sensitive,
+        .smart_case = sj->config_settings->search_smart_case,
+    };
+    GArray *positions = g_array_new(FALSE, FALSE, sizeof(gint));
 
-                haystack_char = d[0];
-                needle_char = z[0];
+    match_substrings(sj->buffer->str, sj->buffer->len, sj->search_query->str, sj->search_query->len, &options,
+                     positions);
 
-                k++;
-            } while (valid_smart_case(haystack_char, needle_char) ||
-                     (!g_unichar_isalpha(needle_char) && needle_char == haystack_char));
+    for (gint i = 0; i < positions->len; i++) {
+        gint position = g_array_index(positions, gint, i);
 
-            if (k - 1 == sj->search_query->len) {
-                Word data = search_substring_make_word(sj, i);
-
-                sj->search_results_count += 1;
-                g_array_append_val(sj->words, data);
-            }
-
-            i++;
+        if (!style_filter_allows(sj, position)) {
+            continue;
         }
-    } else if (!sj->config_settings->search_case_sensitive) {
-        gchar *buffer_lower = g_ascii_strdown(sj->buffer->str, -1);
-        gchar *query_lower = g_ascii_strdown(sj->search_query->str, -1);
 
-        const gchar *b = buffer_lower;
+        gint line = get_line_from_position(sj, sj->first_position + position);
 
-        while ((b = g_strstr_len(b, -1, query_lower))) {
-            gint i = b - buffer_lower;
-            Word data = search_substring_make_word(sj, i);
-
-            g_array_append_val(sj->words, data);
-            sj->search_results_count += 1;
-            b += sj->search_query->len;
-        }
+        Word data = search_substring_make_word(sj, position, line);
 
-        g_free(buffer_lower);
-        g_free(query_lower);
+        g_array_append_val(sj->words, data);
     }
 
+    sj->search_results_count = sj->words->len;
+    g_array_free(positions, TRUE);
+
+    trace_record(TRACE_EXTRACTION, trace_start);
+    trace_start = trace_now();
+
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (word->valid_search) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting, word->length);
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting, word->length);
         }
     }
 
@@ -316,9 +288,11 @@ void search_substring_get_substrings(ShortcutJump *sj) {
     if (sj->search_results_count > 0) {
         Word word = g_array_index(sj->words, Word, sj->search_word_pos);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.length);
     }
 
+    trace_record(TRACE_INDICATORS, trace_start);
+
     sj->search_word_pos_last = get_search_word_pos_last(sj);
 
     ui_set_statusbar(TRUE, _("%i substring%s in view."), sj->search_results_count,
@@ -335,6 +309,10 @@ static gboolean on_key_press_search_substring(GtkWidget *widget, GdkEventKey *ev
     ShortcutJump *sj = (ShortcutJump *)user_data;
     gunichar keychar = gdk_keyval_to_unicode(event->keyval);
 
+    sci_stats_begin_keystroke();
+    recorder_key(event);
+    latency_begin(LATENCY_SEARCH_SUBSTRING, event);
+
     gboolean is_other_char =
         strchr("[]\\;'.,/-=_+{`_+|}:<>?\"~)(*&^% $#@!)", (gchar)gdk_keyval_to_unicode(event->keyval)) ||
         (event->keyval >= GDK_KEY_0 && event->keyval <= GDK_KEY_9) || event->keyval == GDK_KEY_Tab;
@@ -364,15 +342,15 @@ static gboolean on_key_press_search_substring(GtkWidget *widget, GdkEventKey *ev
             sj->search_results_count = 0;
 
             for (gint i = 0; i < sj->words->len; i++) {
-                Word word = g_array_index(sj->words, Word, i);
+                const Word *word = &g_array_index(sj->words, Word, i);
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, 1);
+                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, 1);
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, 1);
+                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, 1);
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, 1);
+                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, 1);
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, 1);
+                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, 1);
             }
         }
 
@@ -404,10 +382,10 @@ static gboolean on_key_press_search_substring(GtkWidget *widget, GdkEventKey *ev
     }
 
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
+        const Word *word = &g_array_index(sj->words, Word, i);
 
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
     }
 
     if (event->keyval == GDK_KEY_Left && sj->search_query->len > 0) {
@@ -442,7 +420,12 @@ static gboolean on_key_press_search_substring(GtkWidget *widget, GdkEventKey *ev
 
 void serach_substring_init(ShortcutJump *sj) {
     sj->current_mode = JM_SUBSTRING;
+    sci_stats_begin_activation();
+    trace_begin_activation();
+    alloc_stats_begin_activation();
+    edit_stats_begin_activation();
     sj->sci = get_scintilla_object();
+    recorder_begin_activation(sj, "search_substring", 0);
     set_selection_info(sj);
 
     define_indicators(sj->sci, sj->config_settings->tag_color, sj->config_settings->highlight_color,
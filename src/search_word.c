@@ -20,20 +20,26 @@
 
 #include "action_text_after.h"
 #include "annotation.h"
+#include "core/match.h"
+#include "core/span.h"
 #include "jump_to_a_word.h"
+#include "latency.h"
 #include "multicursor.h"
 #include "paste.h"
+#include "recorder.h"
 #include "search_common.h"
 #include "selection.h"
+#include "style_filter.h"
+#include "trace.h"
 #include "transpose_string.h"
 #include "util.h"
 #include "values.h"
 
 static void search_word_clear_replace_indicators(ShortcutJump *sj) {
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search) {
-            gint start = sj->first_position + word.replace_pos;
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (word->valid_search) {
+            gint start = sj->first_position + word->replace_pos;
             gint len = sj->replace_len;
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
             scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, start, len);
@@ -47,23 +53,22 @@ static void search_word_clear_replace_indicators(ShortcutJump *sj) {
 
 static void search_word_clear_jump_indicators(ShortcutJump *sj) {
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (word->valid_search) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
         }
     }
 }
 
 void search_word_end(ShortcutJump *sj) {
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        g_string_free(word.word, TRUE);
-    }
+    sci_stats_report(_("Word search"));
+    edit_stats_report(_("Word search"));
+    recorder_end_activation(sj);
 
     free_sj_values(sj);
 
@@ -123,11 +128,11 @@ void search_word_jump_complete(ShortcutJump *sj) {
 
     if (sj->multicursor_mode == MC_ACCEPTING) {
         for (gint i = 0; i < sj->words->len; i++) {
-            Word word = g_array_index(sj->words, Word, i);
-            if (word.valid_search) {
+            const Word *word = &g_array_index(sj->words, Word, i);
+            if (word->valid_search) {
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting_doc, word.word->len);
-                multicursor_add_word(sj, word);
+                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting_doc, word->length);
+                multicursor_add_word(sj, *word);
             }
         }
     }
@@ -135,7 +140,7 @@ void search_word_jump_complete(ShortcutJump *sj) {
     Word word = g_array_index(sj->words, Word, sj->search_word_pos);
     gint pos = word.starting;
     gint line = word.line;
-    gint word_length = word.word->len;
+    gint word_length = word.length;
 
     sj->previous_cursor_pos = sj->current_cursor_pos;
     scintilla_send_message(sj->sci, SCI_GOTOPOS, word.starting, 0);
@@ -194,123 +199,49 @@ void search_word_jump_cancel(ShortcutJump *sj) {
     ui_set_statusbar(TRUE, _("Word search canceled."));
 }
 
+/*
+ * Matches the words from first on against the query and tags the ones that match.
+ */
+static void search_word_match_words(ShortcutJump *sj, gint first, gboolean instant_replace) {
+    MatchOptions options = {
+        .whole_word = instant_replace || sj->config_settings->match_whole_word,
+        .case_sensitive = sj->config_settings->search_case_sensitive,
+        .smart_case = sj->config_settings->search_smart_case,
+        .from_beginning = sj->config_settings->search_start_from_beginning,
+    };
+
+    for (gint i = first; i < sj->words->len; i++) {
+        Word *word = &g_array_index(sj->words, Word, i);
+
+        word->valid_search = match_word(sj->buffer->str + word->replace_pos, word->length, sj->search_query->str,
+                                        sj->search_query->len, &options);
+
+        if (word->valid_search) {
+            sj->search_results_count += 1;
+            scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting, word->length);
+            scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting, word->length);
+        }
+    }
+}
+
 void search_word_mark_words(ShortcutJump *sj, gboolean instant_replace) {
     for (gint i = 0; i < sj->words->len; i++) {
         Word *word = &g_array_index(sj->words, Word, i);
         word->valid_search = FALSE;
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
     }
 
     sj->search_results_count = 0;
     sj->search_word_pos = -1;
 
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word *word = &g_array_index(sj->words, Word, i);
-
-        if (instant_replace) {
-            if (strcmp(word->word->str, sj->search_query->str) == 0) {
-                word->valid_search = TRUE;
-            }
-            continue;
-        }
-
-        if (sj->config_settings->match_whole_word) {
-            if (strcmp(word->word->str, sj->search_query->str) == 0) {
-                word->valid_search = TRUE;
-            }
-            continue;
-        }
-
-        if (sj->config_settings->search_case_sensitive && sj->config_settings->search_smart_case) {
-            if (sj->config_settings->search_start_from_beginning) {
-                for (gchar *p = word->word->str; *p != '\0'; p++) {
-                    gint matched_chars = 0;
-
-                    for (gint z = 0; z < sj->search_query->len; z++) {
-                        gchar haystack_char = word->word->str[z];
-                        gchar needle_char = sj->search_query->str[z];
-
-                        if (valid_smart_case(haystack_char, needle_char)) {
-                            matched_chars += 1;
-                        }
-                    }
-
-                    if (matched_chars == sj->search_query->len) {
-                        word->valid_search = TRUE;
-                    }
-                }
-            }
-
-            if (!sj->config_settings->search_start_from_beginning) {
-                for (gchar *p = word->word->str; *p != '\0'; p++) {
-                    const gchar *z;
-                    gint k = 0;
-                    gchar haystack_char;
-                    gchar needle_char;
-
-                    do {
-                        z = sj->search_query->str + k;
-                        const gchar *d = p + k;
-                        haystack_char = d[0];
-                        needle_char = z[0];
-                        k++;
-                    } while (valid_smart_case(haystack_char, needle_char));
-
-                    if (k - 1 >= 1) {
-                        word->valid_search = TRUE;
-                    }
-                }
-            }
-        }
-
-        if (sj->config_settings->search_case_sensitive && !sj->config_settings->search_smart_case) {
-            if (sj->config_settings->search_start_from_beginning) {
-                if (g_str_has_prefix(word->word->str, sj->search_query->str)) {
-                    word->valid_search = TRUE;
-                }
-            }
-
-            if (!sj->config_settings->search_start_from_beginning) {
-                if (g_strstr_len(word->word->str, -1, sj->search_query->str)) {
-                    word->valid_search = TRUE;
-                }
-            }
-        }
-
-        if (!sj->config_settings->search_case_sensitive && sj->config_settings->search_start_from_beginning) {
-            if (g_ascii_strncasecmp(word->word->str, sj->search_query->str, strlen(sj->search_query->str)) == 0) {
-                word->valid_search = TRUE;
-            }
-        }
-
-        if (!sj->config_settings->search_case_sensitive && !sj->config_settings->search_start_from_beginning) {
-            gchar *word_lower = g_ascii_strdown(word->word->str, -1);
-            gchar *query_lower = g_ascii_strdown(sj->search_query->str, -1);
-
-            if (g_strrstr(word_lower, query_lower)) {
-                word->valid_search = TRUE;
-            }
-
-            g_free(word_lower);
-            g_free(query_lower);
-        }
-    }
-
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search) {
-            sj->search_results_count += 1;
-            scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
-            scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
-        }
-    }
+    search_word_match_words(sj, 0, instant_replace);
 
     gint search_word_pos = 0;
 
@@ -319,8 +250,10 @@ void search_word_mark_words(ShortcutJump *sj, gboolean instant_replace) {
         sj->search_word_pos_first = get_search_word_pos_first(sj);
         sj->search_word_pos = sj->search_word_pos_first;
 
-        Word word = g_array_index(sj->words, Word, sj->search_word_pos);
-        scintilla_send_message(sj->sci, SCI_GOTOPOS, word.starting, 0);
+        if (sj->search_results_count > 0) {
+            Word word = g_array_index(sj->words, Word, sj->search_word_pos);
+            scintilla_send_message(sj->sci, SCI_GOTOPOS, word.starting, 0);
+        }
     } else {
         search_word_pos = get_search_word_pos(sj);
         sj->search_word_pos_first = get_search_word_pos_first(sj);
@@ -330,7 +263,7 @@ void search_word_mark_words(ShortcutJump *sj, gboolean instant_replace) {
     if (sj->search_results_count > 0) {
         Word word = g_array_index(sj->words, Word, sj->search_word_pos);
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.length);
     }
 
     sj->search_word_pos_last = get_search_word_pos_last(sj);
@@ -348,6 +281,10 @@ static gboolean on_key_press_search_word(GtkWidget *widget, GdkEventKey *event,
     ShortcutJump *sj = (ShortcutJump *)user_data;
     gunichar keychar = gdk_keyval_to_unicode(event->keyval);
 
+    sci_stats_begin_keystroke();
+    recorder_key(event);
+    latency_begin(LATENCY_SEARCH_WORD, event);
+
     gboolean is_other_char =
         strchr("[]\\;'.,/-=_+{`_+|}:<>?\"~)(*&^%$#@!)", (gchar)gdk_keyval_to_unicode(event->keyval)) ||
         (event->keyval >= GDK_KEY_0 && event->keyval <= GDK_KEY_9);
@@ -377,15 +314,15 @@ static gboolean on_key_press_search_word(GtkWidget *widget, GdkEventKey *event,
             sj->search_results_count = 0;
 
             for (gint i = 0; i < sj->words->len; i++) {
-                Word word = g_array_index(sj->words, Word, i);
+                const Word *word = &g_array_index(sj->words, Word, i);
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+                scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
             }
         }
 
@@ -417,10 +354,10 @@ static gboolean on_key_press_search_word(GtkWidget *widget, GdkEventKey *event,
     }
 
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
+        const Word *word = &g_array_index(sj->words, Word, i);
 
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->starting, word->length);
     }
 
     if (event->keyval == GDK_KEY_Left && sj->search_query->len > 0) {
@@ -453,28 +390,70 @@ static gboolean on_key_press_search_word(GtkWidget *widget, GdkEventKey *event,
     return FALSE;
 }
 
-void search_word_get_words(ShortcutJump *sj) {
-    for (gint i = 0; i < sj->last_position - sj->first_position; i++) {
-        gint start = scintilla_send_message(sj->sci, SCI_WORDSTARTPOSITION, sj->first_position + i, TRUE);
-        gint end = scintilla_send_message(sj->sci, SCI_WORDENDPOSITION, sj->first_position + i, TRUE);
+static void search_word_append_spans(ShortcutJump *sj, GArray *spans) {
+    style_filter_spans(sj, spans);
 
-        if (start == end || start < sj->first_position || end > sj->last_position) {
-            continue;
-        }
+    for (gint i = 0; i < spans->len; i++) {
+        Span span = g_array_index(spans, Span, i);
 
-        Word data;
+        Word data = {0};
 
-        data.word = g_string_new(sci_get_contents_range(sj->sci, start, end));
-        data.starting_doc = start;
-        data.starting = start;
-        data.replace_pos = i;
-        data.line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, start, 0);
+        data.length = span.length;
+        data.starting_doc = sj->first_position + span.position;
+        data.starting = sj->first_position + span.position;
+        data.replace_pos = span.position;
+        data.line = get_line_from_position(sj, data.starting_doc);
 
         g_array_append_val(sj->words, data);
-        i += data.word->len;
     }
 }
 
+void search_word_get_words(ShortcutJump *sj) {
+    gint64 trace_start = trace_now();
+    GArray *spans = g_array_new(FALSE, FALSE, sizeof(Span));
+
+    get_view_word_spans(sj, sj->buffer->str, spans);
+    search_word_append_spans(sj, spans);
+
+    g_array_free(spans, TRUE);
+    trace_record(TRACE_EXTRACTION, trace_start);
+}
+
+/*
+ * Takes a batch of words handed back by the document index while the search is open, and tags the ones that match
+ * what has been typed so far. The first match moves the cursor the way it would have when the search began.
+ */
+void search_word_add_spans(ShortcutJump *sj, GArray *spans) {
+    gint first = sj->words->len;
+    gint previous_results_count = sj->search_results_count;
+
+    search_word_append_spans(sj, spans);
+
+    if (sj->search_query->len == 0 || sj->current_mode != JM_SEARCH) {
+        return;
+    }
+
+    search_word_match_words(sj, first, FALSE);
+
+    if (sj->search_results_count == previous_results_count) {
+        return;
+    }
+
+    if (previous_results_count == 0) {
+        sj->search_word_pos_first = get_search_word_pos_first(sj);
+        sj->search_word_pos = sj->search_word_pos_first;
+        g_assert(sj->search_word_pos >= 0 && (guint)sj->search_word_pos < sj->words->len);
+
+        Word word = g_array_index(sj->words, Word, sj->search_word_pos);
+        scintilla_send_message(sj->sci, SCI_GOTOPOS, word.starting, 0);
+        scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
+        scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting, word.length);
+    }
+
+    sj->search_word_pos_last = get_search_word_pos_last(sj);
+    annotation_display_search(sj);
+}
+
 void search_word_set_query(ShortcutJump *sj, gboolean instant_replace) {
     gint start = scintilla_send_message(sj->sci, SCI_WORDSTARTPOSITION, sj->current_cursor_pos, TRUE);
     gint end = scintilla_send_message(sj->sci, SCI_WORDENDPOSITION, sj->current_cursor_pos, TRUE);
@@ -491,7 +470,12 @@ void search_word_set_query(ShortcutJump *sj, gboolean instant_replace) {
 
 void search_word_init(ShortcutJump *sj, gboolean instant_replace) {
     sj->current_mode = JM_SEARCH;
+    sci_stats_begin_activation();
+    trace_begin_activation();
+    alloc_stats_begin_activation();
+    edit_stats_begin_activation();
     sj->sci = get_scintilla_object();
+    recorder_begin_activation(sj, "search_word", instant_replace);
     set_selection_info(sj);
 
     define_indicators(sj->sci, sj->config_settings->tag_color, sj->config_settings->highlight_color,
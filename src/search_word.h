@@ -29,6 +29,7 @@ void search_word_init(ShortcutJump *sj, gboolean instant_replace);
 void search_word_cb(GtkMenuItem *menu_item, gpointer user_data);
 gboolean search_word_kb(GeanyKeyBinding *kb, guint key_id, gpointer user_data);
 void search_word_get_words(ShortcutJump *sj);
+void search_word_add_spans(ShortcutJump *sj, GArray *spans);
 void search_word_set_query(ShortcutJump *sj, gboolean instant_replace);
 void search_word_replace_cancel(ShortcutJump *sj);
 void search_word_replace_complete(ShortcutJump *sj);
@@ -19,11 +19,12 @@
 #include <plugindata.h>
 
 #include "jump_to_a_word.h"
+#include "trace.h"
+#include "util.h"
 
-static gboolean selection_is_a_word(ScintillaObject *sci, gint selection_start, gint selection_end) {
-    char word_chars[256];
-
-    scintilla_send_message(sci, SCI_GETWORDCHARS, 0, (sptr_t)word_chars);
+static gboolean selection_is_a_word(ShortcutJump *sj, gint selection_start, gint selection_end) {
+    ScintillaObject *sci = sj->sci;
+    const WordChars *word_chars = get_word_chars(sj);
 
     gint start_of_first = scintilla_send_message(sci, SCI_WORDSTARTPOSITION, selection_start, TRUE);
     gint end_of_first = scintilla_send_message(sci, SCI_WORDENDPOSITION, selection_start, TRUE);
@@ -31,20 +32,13 @@ static gboolean selection_is_a_word(ScintillaObject *sci, gint selection_start,
     gint start_of_last = scintilla_send_message(sci, SCI_WORDSTARTPOSITION, selection_end, TRUE);
     gint end_of_last = scintilla_send_message(sci, SCI_WORDENDPOSITION, selection_end, TRUE);
 
-    gchar left_bound = scintilla_send_message(sci, SCI_GETCHARAT, selection_start - 1, 0);
-    gchar right_bound = scintilla_send_message(sci, SCI_GETCHARAT, selection_end, 0);
+    guchar left_bound = scintilla_send_message(sci, SCI_GETCHARAT, selection_start - 1, 0);
+    guchar right_bound = scintilla_send_message(sci, SCI_GETCHARAT, selection_end, 0);
 
     gint len = scintilla_send_message(sci, SCI_GETLENGTH, 0, 0);
 
-    gboolean bound_is_word_char = FALSE;
-
-    for (char *p = word_chars; *p != '\0'; p++) {
-        guchar ch = (*p >= 32 && *p <= 126) ? *p : '?';
-
-        if ((start_of_first - 1 <= 0 && left_bound == ch) || (end_of_last < len && right_bound == ch)) {
-            bound_is_word_char = TRUE;
-        }
-    }
+    gboolean bound_is_word_char = (start_of_first - 1 <= 0 && word_chars->word[left_bound]) ||
+                                  (end_of_last < len && word_chars->word[right_bound]);
 
     return start_of_first != end_of_last && start_of_first == start_of_last && end_of_first == end_of_last &&
            !bound_is_word_char;
@@ -64,14 +58,25 @@ static gboolean selection_is_a_line(const ShortcutJump *sj, ScintillaObject *sci
     return FALSE;
 }
 
-void set_selection_info(ShortcutJump *sj) {
+/* Reads the selection without adding to the activation trace, for work done ahead of an activation */
+void read_selection_info(ShortcutJump *sj) {
     gint selection_start = scintilla_send_message(sj->sci, SCI_GETSELECTIONSTART, 0, 0);
     gint selection_end = scintilla_send_message(sj->sci, SCI_GETSELECTIONEND, 0, 0);
+    gint char_width;
+
+    get_char_at(sj->sci, selection_start, &char_width);
 
     sj->in_selection = selection_start != selection_end && sj->current_mode != JM_LINE;
     sj->selection_start = selection_start;
     sj->selection_end = selection_end;
-    sj->selection_is_a_char = selection_end == selection_start + 1;
-    sj->selection_is_a_word = selection_is_a_word(sj->sci, selection_start, selection_end);
+    sj->selection_is_a_char = selection_end == selection_start + char_width;
+    sj->selection_is_a_word = selection_is_a_word(sj, selection_start, selection_end);
     sj->selection_is_within_a_line = selection_is_a_line(sj, sj->sci, selection_start, selection_end);
 }
+
+void set_selection_info(ShortcutJump *sj) {
+    gint64 trace_start = trace_now();
+
+    read_selection_info(sj);
+    trace_record(TRACE_SELECTION_INFO, trace_start);
+}
@@ -21,6 +21,7 @@
 
 #include "jump_to_a_word.h"
 
+void read_selection_info(ShortcutJump *sj);
 void set_selection_info(ShortcutJump *sj);
 
 #endif
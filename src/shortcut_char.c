@@ -20,22 +20,21 @@
 
 #include "action_text_after.h"
 #include "annotation.h"
+#include "core/utf8_scan.h"
 #include "jump_to_a_word.h"
 #include "paste.h"
+#include "recorder.h"
 #include "replace_handle_input.h"
 #include "selection.h"
 #include "shortcut_common.h"
+#include "style_filter.h"
+#include "trace.h"
 #include "transpose_string.h"
 #include "util.h"
 #include "values.h"
 
 void shortcut_char_jumping_cancel(ShortcutJump *sj) {
-    scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETSTART, sj->first_position, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETEND, sj->first_position + sj->buffer->len, 0);
-    scintilla_send_message(sj->sci, SCI_REPLACETARGET, -1, (sptr_t)sj->cache->str);
-    scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
-    scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+    shortcut_remove_tags(sj);
     scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->current_cursor_pos, 0);
     shortcut_set_to_first_visible_line(sj);
     annotation_clear(sj->sci, sj->eol_message_line);
@@ -48,12 +47,7 @@ void shortcut_char_jumping_cancel(ShortcutJump *sj) {
 }
 
 void shortcut_char_jumping_complete(ShortcutJump *sj, gint pos, gint word_length, gint line) {
-    scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETSTART, sj->first_position, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETEND, sj->first_position + sj->buffer->len, 0);
-    scintilla_send_message(sj->sci, SCI_REPLACETARGET, -1, (sptr_t)sj->cache->str);
-    scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
-    scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+    shortcut_remove_tags(sj);
 
     sj->previous_cursor_pos = sj->current_cursor_pos;
 
@@ -100,14 +94,14 @@ void shortcut_char_waiting_cancel(ShortcutJump *sj) {
 
 static void shortcut_char_replacing_clear_indicators(ShortcutJump *sj) {
     for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-        if (word.valid_search) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+        if (word->valid_search) {
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.replace_pos + sj->first_position,
-                                   sj->replace_len == 0 ? word.word->len : sj->replace_len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->replace_pos + sj->first_position,
+                                   sj->replace_len == 0 ? word->length : sj->replace_len);
             scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.replace_pos + sj->first_position,
-                                   sj->replace_len == 0 ? word.word->len : sj->replace_len);
+            scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word->replace_pos + sj->first_position,
+                                   sj->replace_len == 0 ? word->length : sj->replace_len);
         }
     }
 }
@@ -159,80 +153,87 @@ void shortcut_char_replacing_complete(ShortcutJump *sj) {
     shortcut_end(sj, FALSE);
 }
 
-void shortcut_char_get_chars(ShortcutJump *sj, gchar query) {
+/*
+ * The occurrences of the query are found in the text of the view in one pass, the ASCII stretches of it a block at a
+ * time. A run of the same character gets a tag on every other occurrence, and each target spans all of the bytes of
+ * its character.
+ */
+void shortcut_char_get_chars(ShortcutJump *sj, gunichar query) {
+    gint64 trace_start = trace_now();
+    gint length = MAX(sj->last_position - sj->first_position, 0);
+    const gchar *text = "";
     gint lfs_added = 0;
     gint toggle = 1;
     gint added = 0;
     gint prev_line;
-    gchar prev_char;
+    gchar encoded[6];
+    gint query_bytes = g_unichar_to_utf8(query, encoded);
+    GArray *positions = g_array_new(FALSE, FALSE, sizeof(gint));
+
+    if (length > 0) {
+        text = (const gchar *)scintilla_send_message(sj->sci, SCI_GETRANGEPOINTER, sj->first_position, length);
+        utf8_scan_find_char(text, length, query, positions);
+    }
 
     if (sj->in_selection && sj->config_settings->search_from_selection) {
-        prev_line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, sj->first_position, 0);
+        prev_line = get_line_from_position(sj, sj->first_position);
     } else {
         prev_line = sj->first_line_on_screen - 1;
     }
 
-    for (gint i = sj->first_position; i < sj->last_position; i++) {
+    for (gint k = 0; k < positions->len; k++) {
         if (added == shortcut_get_max_words(sj->config_settings->shortcuts_include_single_char)) {
             break;
         }
 
-        gchar current_char = scintilla_send_message(sj->sci, SCI_GETCHARAT, i, TRUE);
+        gint offset = g_array_index(positions, gint, k);
+        gint i = sj->first_position + offset;
+        gboolean follows_query = k > 0 && g_array_index(positions, gint, k - 1) + query_bytes == offset;
 
-        if (current_char != query) {
+        if (!style_filter_allows(sj, offset)) {
             continue;
         }
 
-        gchar char_to_the_left = scintilla_send_message(sj->sci, SCI_GETCHARAT, i - 1, TRUE);
-
-        if (char_to_the_left != prev_char) {
+        if (!follows_query) {
             toggle = 1;
         }
 
-        Word word;
+        Word word = {0};
         gboolean ignore_hidden_neighbor_skip = FALSE;
 
         if (sj->config_settings->shortcuts_include_single_char && sj->words->len <= 26) {
             ignore_hidden_neighbor_skip = TRUE;
         }
 
-        if (current_char == query && prev_char == current_char && toggle == 0 && !ignore_hidden_neighbor_skip) {
-            GString *ch = g_string_new("");
-            g_string_insert_c(ch, 0, current_char);
-            word.word = ch;
-            word.valid_search = TRUE;
+        word.length = query_bytes;
+        word.valid_search = TRUE;
+        word.starting = i + lfs_added;
+        word.starting_doc = i;
+        word.bytes = query_bytes;
+        word.line = get_line_from_position(sj, i);
+        word.padding = 0;
+        word.replace_pos = offset;
+
+        if (follows_query && toggle == 0 && !ignore_hidden_neighbor_skip) {
             word.is_hidden_neighbor = TRUE;
-            word.starting = i + lfs_added;
-            word.starting_doc = i;
-            word.bytes = shortcut_get_utf8_char_length(word.word->str[0]);
-            word.line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, i, 0);
-            word.padding = shortcut_set_padding(sj, word.word->len);
-            word.replace_pos = i - sj->first_position;
+            word.shortcut_length = 0;
             g_array_append_val(sj->words, word);
             toggle ^= 1;
             continue;
         }
 
-        GString *ch = g_string_new("");
-        g_string_insert_c(ch, 0, current_char);
-        word.word = ch;
-        word.valid_search = TRUE;
         word.is_hidden_neighbor = FALSE;
-        word.starting = i + lfs_added;
-        word.starting_doc = i;
-        word.bytes = shortcut_get_utf8_char_length(word.word->str[0]);
-        word.line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, i, 0);
-        word.padding = shortcut_set_padding(sj, word.word->len);
-        word.replace_pos = i - sj->first_position;
-        word.shortcut = shortcut_make_tag(sj->config_settings->shortcuts_include_single_char,
-                                          sj->config_settings->shortcut_all_caps, added++);
+        word.shortcut_length = shortcut_make_tag(word.shortcut, sj->config_settings->shortcuts_include_single_char,
+                                                 sj->config_settings->shortcut_all_caps, added++);
         toggle ^= 1;
 
-        gchar line_ending_char = scintilla_send_message(sj->sci, SCI_GETCHARAT, i + 1, TRUE);
+        gint end = i + query_bytes;
+        gchar line_ending_char = end < sj->last_position ? text[end - sj->first_position]
+                                                         : scintilla_send_message(sj->sci, SCI_GETCHARAT, end, TRUE);
 
-        if (line_ending_char == '\n' && word.shortcut->len == 2) {
-            g_string_insert_c(sj->buffer, lfs_added + i - sj->first_position, '\n');
-            gint line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, i, 0);
+        if (line_ending_char == '\n' && word.shortcut_length > query_bytes && !sj->config_settings->label_overlay) {
+            g_string_insert_c(sj->buffer, lfs_added + offset, '\n');
+            gint line = word.line;
 
             if (line != prev_line) {
                 for (gint i = prev_line; i < line; i++) {
@@ -246,14 +247,17 @@ void shortcut_char_get_chars(ShortcutJump *sj, gchar query) {
         }
 
         g_array_append_val(sj->words, word);
-        prev_char = current_char;
     }
 
+    g_array_free(positions, TRUE);
+
     for (gint i = prev_line; i < sj->last_line_on_screen; i++) {
         g_array_append_val(sj->lf_positions, lfs_added);
     }
 
     sj->search_results_count = sj->words->len;
+
+    trace_record(TRACE_EXTRACTION, trace_start);
 }
 
 static gboolean shortcut_char_on_click_event(GtkWidget *widget, GdkEventButton *event, gpointer user_data) {
@@ -281,6 +285,9 @@ static gboolean shortcut_char_on_key_press(GtkWidget *widget, GdkEventKey *event
     ShortcutJump *sj = (ShortcutJump *)user_data;
     gunichar query = gdk_keyval_to_unicode(event->keyval);
 
+    sci_stats_begin_keystroke();
+    recorder_key(event);
+
     if (sj->current_mode == JM_SHORTCUT_CHAR_ACCEPTING) {
         if (mod_key_pressed(event)) {
             return TRUE;
@@ -293,17 +300,20 @@ static gboolean shortcut_char_on_key_press(GtkWidget *widget, GdkEventKey *event
             return TRUE;
         }
 
-        sj->buffer = shortcut_mask_bytes(sj->words, sj->buffer, sj->first_position);
-        sj->buffer = shortcut_set_tags_in_buffer(sj->words, sj->buffer, sj->first_position);
+        if (!sj->config_settings->label_overlay) {
+            sj->buffer = shortcut_mask_bytes(sj->words, sj->buffer, sj->first_position);
+            sj->buffer = shortcut_set_tags_in_buffer(sj->words, sj->buffer, sj->first_position);
+        }
+
         sj->current_cursor_pos = scintilla_send_message(sj->sci, SCI_GETCURRENTPOS, 0, 0);
         shortcut_set_after_placement(sj);
-        shortcut_set_indicators(sj->sci, sj->words);
+        shortcut_set_indicators(sj);
         sj->current_mode = JM_SHORTCUT_CHAR_JUMPING;
         ui_set_statusbar(TRUE, _("%i character%s in view."), sj->words->len, sj->words->len == 1 ? "" : "s");
 
         if (sj->words->len == 1 && !sj->config_settings->wait_for_enter) {
             Word word = g_array_index(sj->words, Word, sj->shortcut_single_pos);
-            shortcut_char_jumping_complete(sj, word.starting_doc, word.word->len, word.line);
+            shortcut_char_jumping_complete(sj, word.starting_doc, word.length, word.line);
             return TRUE;
         }
 
@@ -323,9 +333,14 @@ static gboolean shortcut_char_on_key_press(GtkWidget *widget, GdkEventKey *event
     return FALSE;
 }
 
-void shortcut_char_init_with_query(ShortcutJump *sj, gchar query) {
+void shortcut_char_init_with_query(ShortcutJump *sj, gunichar query) {
     sj->current_mode = JM_SHORTCUT_CHAR_ACCEPTING;
+    sci_stats_begin_activation();
+    trace_begin_activation();
+    alloc_stats_begin_activation();
+    edit_stats_begin_activation();
     sj->sci = get_scintilla_object();
+    recorder_begin_activation(sj, "shortcut_char_with_query", query);
     init_sj_values(sj);
 
     define_indicators(sj->sci, sj->config_settings->tag_color, sj->config_settings->highlight_color,
@@ -335,7 +350,7 @@ void shortcut_char_init_with_query(ShortcutJump *sj, gchar query) {
         if (sj->selection_is_a_char && sj->config_settings->use_selected_word_or_char) {
             shortcut_char_get_chars(sj, query);
 
-            g_string_append_c(sj->search_query, query);
+            g_string_append_unichar(sj->search_query, query);
 
             sj->current_mode = JM_SHORTCUT_CHAR_JUMPING;
             ui_set_statusbar(TRUE, _("%i character%s in view."), sj->words->len, sj->words->len == 1 ? "" : "s");
@@ -350,7 +365,12 @@ void shortcut_char_init_with_query(ShortcutJump *sj, gchar query) {
 
 void shortcut_char_init(ShortcutJump *sj) {
     sj->current_mode = JM_SHORTCUT_CHAR_ACCEPTING;
+    sci_stats_begin_activation();
+    trace_begin_activation();
+    alloc_stats_begin_activation();
+    edit_stats_begin_activation();
     sj->sci = get_scintilla_object();
+    recorder_begin_activation(sj, "shortcut_char", 0);
     set_selection_info(sj);
     init_sj_values(sj);
 
@@ -363,14 +383,18 @@ void shortcut_char_init(ShortcutJump *sj) {
 
     if (sj->in_selection) {
         if (sj->selection_is_a_char && sj->config_settings->use_selected_word_or_char) {
-            gchar query = scintilla_send_message(sj->sci, SCI_GETCHARAT, sj->selection_start, sj->selection_end);
+            gint width;
+            gunichar query = get_char_at(sj->sci, sj->selection_start, &width);
             shortcut_char_get_chars(sj, query);
 
-            sj->buffer = shortcut_mask_bytes(sj->words, sj->buffer, sj->first_position);
-            sj->buffer = shortcut_set_tags_in_buffer(sj->words, sj->buffer, sj->first_position);
+            if (!sj->config_settings->label_overlay) {
+                sj->buffer = shortcut_mask_bytes(sj->words, sj->buffer, sj->first_position);
+                sj->buffer = shortcut_set_tags_in_buffer(sj->words, sj->buffer, sj->first_position);
+            }
+
             sj->current_cursor_pos = scintilla_send_message(sj->sci, SCI_GETCURRENTPOS, 0, 0);
             shortcut_set_after_placement(sj);
-            shortcut_set_indicators(sj->sci, sj->words);
+            shortcut_set_indicators(sj);
 
             sj->current_mode = JM_SHORTCUT_CHAR_JUMPING;
             ui_set_statusbar(TRUE, _("%i character%s in view."), sj->words->len, sj->words->len == 1 ? "" : "s");
@@ -19,26 +19,25 @@
 #include <math.h>
 #include <plugindata.h>
 
+#include "core/label.h"
 #include "jump_to_a_word.h"
+#include "label_overlay.h"
+#include "latency.h"
 #include "multicursor.h"
+#include "recorder.h"
 #include "search_substring.h"
 #include "search_word.h"
 #include "shortcut_char.h"
 #include "shortcut_line.h"
 #include "shortcut_word.h"
+#include "trace.h"
 #include "util.h"
 #include "values.h"
 
 void shortcut_end(ShortcutJump *sj, gboolean was_canceled) {
-    for (gint i = 0; i < sj->words->len; i++) {
-        Word word = g_array_index(sj->words, Word, i);
-
-        g_string_free(word.word, TRUE);
-
-        if (!word.is_hidden_neighbor) {
-            g_string_free(word.shortcut, TRUE);
-        }
-    }
+    sci_stats_report(_("Shortcut jump"));
+    edit_stats_report(_("Shortcut jump"));
+    recorder_end_activation(sj);
 
     gboolean in_line_jump_mode;
 
@@ -48,21 +47,24 @@ void shortcut_end(ShortcutJump *sj, gboolean was_canceled) {
         in_line_jump_mode = FALSE;
     }
 
+    label_overlay_hide(sj);
     free_sj_values(sj);
 
     sj->current_mode = JM_NONE;
 
     if (sj->multicursor_mode == MC_ACCEPTING) {
         for (gint i = 0; i < sj->multicursor_words->len; i++) {
-            Word word = g_array_index(sj->multicursor_words, Word, i);
+            const Word *word = &g_array_index(sj->multicursor_words, Word, i);
 
-            if (word.valid_search) {
+            if (word->valid_search) {
                 scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word.starting_doc, word.word->len);
+                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, word->starting_doc, word->length);
             }
         }
     }
 
+    alloc_stats_report("shortcut_end");
+
     if (in_line_jump_mode && !was_canceled) {
         if (sj->config_settings->line_after == LA_JUMP_TO_CHARACTER_SHORTCUT) {
             shortcut_char_init(sj);
@@ -90,13 +92,24 @@ gint shortcut_get_max_words(gint shortcuts_include_single_char) {
     }
 }
 
+/*
+ * Blanks the character under each tag. A tag longer than the character runs into the characters after it, so those
+ * are blanked whole as well and no multibyte character is left cut in two.
+ */
 GString *shortcut_mask_bytes(GArray *words, GString *buffer, gint first_position) {
     for (gint i = 0; i < words->len; i++) {
-        Word word = g_array_index(words, Word, i);
-        gint starting = word.starting - first_position;
+        const Word *word = &g_array_index(words, Word, i);
+        gint starting = word->starting - first_position + word->padding;
+        gint end = starting + MAX(word->bytes, word->is_hidden_neighbor ? 0 : word->shortcut_length);
 
-        for (gint j = 0; j < word.bytes; j++) {
-            buffer->str[starting + j + word.padding] = ' ';
+        end = MIN(end, buffer->len);
+
+        while (end < buffer->len && ((guchar)buffer->str[end] & 0xC0) == 0x80) {
+            end++;
+        }
+
+        for (gint j = starting; j < end; j++) {
+            buffer->str[j] = ' ';
         }
     }
 
@@ -105,12 +118,12 @@ GString *shortcut_mask_bytes(GArray *words, GString *buffer, gint first_position
 
 GString *shortcut_set_tags_in_buffer(GArray *words, GString *buffer, gint first_position) {
     for (gint i = 0; i < words->len; i++) {
-        Word word = g_array_index(words, Word, i);
-        gint starting = word.starting - first_position;
+        const Word *word = &g_array_index(words, Word, i);
+        gint starting = word->starting - first_position;
 
-        if (!word.is_hidden_neighbor) {
-            for (gint j = 0; j < word.shortcut->len; j++) {
-                buffer->str[starting + j + word.padding] = word.shortcut->str[j];
+        if (!word->is_hidden_neighbor) {
+            for (gint j = 0; j < word->shortcut_length; j++) {
+                buffer->str[starting + j + word->padding] = word->shortcut[j];
             }
         }
     }
@@ -118,37 +131,9 @@ GString *shortcut_set_tags_in_buffer(GArray *words, GString *buffer, gint first_
     return buffer;
 }
 
-GString *shortcut_make_tag(gint shortcuts_include_single_char, gint shortcut_all_caps, gint position) {
-    if (!shortcuts_include_single_char) {
-        position += 26;
-    }
-
-    if (position < 0) {
-        return NULL;
-    }
-
-    gint word_length = 1;
-    gint temp = position;
-
-    while (temp >= 26) {
-        temp = (temp / 26) - 1;
-        word_length++;
-    }
-
-    GString *result = g_string_new("");
-
-    if (!result) {
-        return NULL;
-    }
-
-    for (gint i = word_length - 1; i >= 0; i--) {
-        gchar ch = (shortcut_all_caps ? 'A' : 'a') + (position % 26);
-
-        g_string_prepend_c(result, ch);
-        position = (position / 26) - 1;
-    }
-
-    return result;
+gint shortcut_make_tag(gchar tag[LABEL_MAX_LENGTH], gint shortcuts_include_single_char, gint shortcut_all_caps,
+                       gint position) {
+    return label_format(tag, shortcuts_include_single_char, shortcut_all_caps, position);
 }
 
 static gint shortcut_get_search_results_count(ScintillaObject *sci, GArray *words) {
@@ -167,9 +152,9 @@ static gint shortcut_get_search_results_count(ScintillaObject *sci, GArray *word
 
 static gint shortcut_get_highlighted_pos(ScintillaObject *sci, GArray *words) {
     for (gint i = 0; i < words->len; i++) {
-        Word word = g_array_index(words, Word, i);
+        const Word *word = &g_array_index(words, Word, i);
 
-        if (word.valid_search) {
+        if (word->valid_search) {
             return i;
         }
     }
@@ -194,11 +179,11 @@ static GArray *shortcut_mark_indicators(ScintillaObject *sci, GArray *words, GSt
             continue;
         }
 
-        if (g_str_has_prefix(word->shortcut->str, search_query->str) && search_query->len > 0) {
+        if (g_str_has_prefix(word->shortcut, search_query->str) && search_query->len > 0) {
             word->shortcut_marked = TRUE;
         }
 
-        if (g_strcmp0(word->shortcut->str, search_query->str) == 0) {
+        if (g_strcmp0(word->shortcut, search_query->str) == 0) {
             word->valid_search = TRUE;
         }
     }
@@ -206,18 +191,21 @@ static GArray *shortcut_mark_indicators(ScintillaObject *sci, GArray *words, GSt
     return words;
 }
 
-gint shortcut_get_utf8_char_length(gchar c) {
-    if ((c & 0x80) == 0) {
-        return 1;
-    } else if ((c & 0xE0) == 0xC0) {
-        return 2;
-    } else if ((c & 0xF0) == 0xE0) {
-        return 3;
-    } else if ((c & 0xF8) == 0xF0) {
-        return 4;
+/* Marks what has been typed so far on the tags it matches */
+static void shortcut_highlight_typed(ShortcutJump *sj) {
+    if (sj->config_settings->label_overlay) {
+        label_overlay_refresh(sj);
+        return;
     }
 
-    return -1;
+    for (gint i = 0; i < sj->words->len; i++) {
+        const Word *word = &g_array_index(sj->words, Word, i);
+        gint start = word->starting + word->padding;
+
+        if (word->shortcut_marked) {
+            scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, start, sj->search_query->len);
+        }
+    }
 }
 
 gint shortcut_set_padding(ShortcutJump *sj, gint word_length) {
@@ -228,7 +216,20 @@ gint shortcut_set_padding(ShortcutJump *sj, gint word_length) {
     return 0;
 }
 
+/*
+ * Puts the tags of the activation in front of the user: drawn over the view with the label overlay on, and otherwise
+ * written into the document in one replacement that is undone when the activation ends.
+ */
 void shortcut_set_after_placement(ShortcutJump *sj) {
+    gint64 trace_start = trace_now();
+
+    if (sj->config_settings->label_overlay) {
+        scintilla_send_message(sj->sci, SCI_SETREADONLY, 1, 0);
+        label_overlay_show(sj);
+        trace_record(TRACE_PLACEMENT, trace_start);
+        return;
+    }
+
     gint current_line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, sj->current_cursor_pos, 0);
     gint lfs_added = get_lfs(sj, current_line);
 
@@ -238,15 +239,43 @@ void shortcut_set_after_placement(ShortcutJump *sj) {
     scintilla_send_message(sj->sci, SCI_BEGINUNDOACTION, 0, 0);
     scintilla_send_message(sj->sci, SCI_SETTARGETSTART, sj->first_position, 0);
     scintilla_send_message(sj->sci, SCI_SETTARGETEND, sj->last_position, 0);
+    sj->placing_tags = TRUE;
     scintilla_send_message(sj->sci, SCI_REPLACETARGET, -1, (sptr_t)sj->buffer->str);
+    sj->placing_tags = FALSE;
     scintilla_send_message(sj->sci, SCI_SETREADONLY, 1, 0);
     scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->current_cursor_pos + lfs_added, 0);
+
+    trace_record(TRACE_PLACEMENT, trace_start);
+}
+
+/*
+ * Puts back the text the tags were placed over and undoes the placement. Neither edit changes the document version,
+ * as the document is then as it was before the activation. Tags drawn by the overlay only need to be taken off the
+ * view.
+ */
+void shortcut_remove_tags(ShortcutJump *sj) {
+    if (sj->config_settings->label_overlay) {
+        scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
+        label_overlay_hide(sj);
+        return;
+    }
+
+    scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
+    scintilla_send_message(sj->sci, SCI_SETTARGETSTART, sj->first_position, 0);
+    scintilla_send_message(sj->sci, SCI_SETTARGETEND, sj->first_position + sj->buffer->len, 0);
+    sj->placing_tags = TRUE;
+    scintilla_send_message(sj->sci, SCI_REPLACETARGET, -1, (sptr_t)sj->cache->str);
+    scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
+    scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+    sj->placing_tags = FALSE;
 }
 
 gint shortcut_on_key_press_action(GdkEventKey *event, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
     gunichar keychar = gdk_keyval_to_unicode(event->keyval);
 
+    latency_begin(LATENCY_SHORTCUT, event);
+
     scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_HIGHLIGHT, 0);
     sj->words = shortcut_mark_indicators(sj->sci, sj->words, sj->search_query);
     sj->search_results_count = shortcut_get_search_results_count(sj->sci, sj->words);
@@ -271,14 +300,7 @@ gint shortcut_on_key_press_action(GdkEventKey *event, gpointer user_data) {
         g_string_truncate(sj->search_query, sj->search_query->len - 1);
         sj->words = shortcut_mark_indicators(sj->sci, sj->words, sj->search_query);
 
-        for (gint i = 0; i < sj->words->len; i++) {
-            Word word = g_array_index(sj->words, Word, i);
-            gint start = word.starting + word.padding;
-
-            if (word.shortcut_marked) {
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, start, sj->search_query->len);
-            }
-        }
+        shortcut_highlight_typed(sj);
         return TRUE;
     }
 
@@ -323,11 +345,11 @@ gint shortcut_on_key_press_action(GdkEventKey *event, gpointer user_data) {
         }
 
         if (sj->current_mode == JM_SHORTCUT_CHAR_JUMPING) {
-            shortcut_char_jumping_complete(sj, word.starting_doc, word.word->len, word.line);
+            shortcut_char_jumping_complete(sj, word.starting_doc, word.length, word.line);
         } else if (sj->current_mode == JM_LINE) {
-            shortcut_line_complete(sj, word.starting_doc, word.word->len, word.line);
+            shortcut_line_complete(sj, word.starting_doc, word.length, word.line);
         } else if (sj->current_mode == JM_SHORTCUT_WORD) {
-            shortcut_word_complete(sj, word.starting_doc, word.word->len, word.line);
+            shortcut_word_complete(sj, word.starting_doc, word.length, word.line);
         }
 
         return TRUE;
@@ -352,14 +374,7 @@ gint shortcut_on_key_press_action(GdkEventKey *event, gpointer user_data) {
             return TRUE;
         }
 
-        for (gint i = 0; i < sj->words->len; i++) {
-            Word word = g_array_index(sj->words, Word, i);
-            gint start = word.starting + word.padding;
-
-            if (word.shortcut_marked) {
-                scintilla_send_message(sj->sci, SCI_INDICATORFILLRANGE, start, sj->search_query->len);
-            }
-        }
+        shortcut_highlight_typed(sj);
 
         if (sj->search_results_count == 1 && !sj->config_settings->wait_for_enter) {
             Word word = g_array_index(sj->words, Word, sj->shortcut_single_pos);
@@ -369,11 +384,11 @@ gint shortcut_on_key_press_action(GdkEventKey *event, gpointer user_data) {
             }
 
             if (sj->current_mode == JM_SHORTCUT_CHAR_JUMPING) {
-                shortcut_char_jumping_complete(sj, word.starting_doc, word.word->len, word.line);
+                shortcut_char_jumping_complete(sj, word.starting_doc, word.length, word.line);
             } else if (sj->current_mode == JM_LINE) {
-                shortcut_line_complete(sj, word.starting_doc, word.word->len, word.line);
+                shortcut_line_complete(sj, word.starting_doc, word.length, word.line);
             } else if (sj->current_mode == JM_SHORTCUT_WORD) {
-                shortcut_word_complete(sj, word.starting_doc, word.word->len, word.line);
+                shortcut_word_complete(sj, word.starting_doc, word.length, word.line);
             }
         }
 
@@ -391,15 +406,26 @@ gint shortcut_on_key_press_action(GdkEventKey *event, gpointer user_data) {
     return FALSE;
 }
 
-void shortcut_set_indicators(ScintillaObject *sci, GArray *words) {
+void shortcut_set_indicators(ShortcutJump *sj) {
+    gint64 trace_start = trace_now();
+    ScintillaObject *sci = sj->sci;
+    GArray *words = sj->words;
+
+    if (sj->config_settings->label_overlay) {
+        trace_record(TRACE_INDICATORS, trace_start);
+        return;
+    }
+
     for (gint i = 0; i < words->len; i++) {
-        Word word = g_array_index(words, Word, i);
+        const Word *word = &g_array_index(words, Word, i);
 
-        if (!word.is_hidden_neighbor) {
+        if (!word->is_hidden_neighbor) {
             scintilla_send_message(sci, SCI_SETINDICATORCURRENT, INDICATOR_TAG, 0);
-            scintilla_send_message(sci, SCI_INDICATORFILLRANGE, word.starting + word.padding, word.shortcut->len);
+            scintilla_send_message(sci, SCI_INDICATORFILLRANGE, word->starting + word->padding, word->shortcut_length);
             scintilla_send_message(sci, SCI_SETINDICATORCURRENT, INDICATOR_TEXT, 0);
-            scintilla_send_message(sci, SCI_INDICATORFILLRANGE, word.starting + word.padding, word.shortcut->len);
+            scintilla_send_message(sci, SCI_INDICATORFILLRANGE, word->starting + word->padding, word->shortcut_length);
         }
     }
+
+    trace_record(TRACE_INDICATORS, trace_start);
 }
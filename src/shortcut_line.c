@@ -19,19 +19,17 @@
 #include <plugindata.h>
 
 #include "action_line_after.h"
+#include "core/utf8_scan.h"
 #include "jump_to_a_word.h"
+#include "recorder.h"
 #include "selection.h"
 #include "shortcut_common.h"
+#include "trace.h"
 #include "util.h"
 #include "values.h"
 
 void shortcut_line_complete(ShortcutJump *sj, gint pos, gint word_length, gint line) {
-    scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETSTART, sj->first_position, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETEND, sj->first_position + sj->buffer->len, 0);
-    scintilla_send_message(sj->sci, SCI_REPLACETARGET, -1, (sptr_t)sj->cache->str);
-    scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
-    scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+    shortcut_remove_tags(sj);
 
     sj->previous_cursor_pos = sj->current_cursor_pos;
 
@@ -55,12 +53,7 @@ void shortcut_line_complete(ShortcutJump *sj, gint pos, gint word_length, gint l
 }
 
 void shortcut_line_cancel(ShortcutJump *sj) {
-    scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETSTART, sj->first_position, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETEND, sj->first_position + sj->buffer->len, 0);
-    scintilla_send_message(sj->sci, SCI_REPLACETARGET, -1, (sptr_t)sj->cache->str);
-    scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
-    scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+    shortcut_remove_tags(sj);
     scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->current_cursor_pos, 0);
     shortcut_set_to_first_visible_line(sj);
     sj->range_is_set = FALSE;
@@ -74,6 +67,9 @@ void shortcut_line_cancel(ShortcutJump *sj) {
 static gboolean shortcut_line_on_key_press(GtkWidget *widget, GdkEventKey *event, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
 
+    sci_stats_begin_keystroke();
+    recorder_key(event);
+
     return shortcut_on_key_press_action(event, sj);
 }
 
@@ -92,7 +88,12 @@ static gboolean shortcut_line_on_click_event(GtkWidget *widget, GdkEventButton *
 
 void shortcut_line_init(ShortcutJump *sj) {
     sj->current_mode = JM_LINE;
+    sci_stats_begin_activation();
+    trace_begin_activation();
+    alloc_stats_begin_activation();
+    edit_stats_begin_activation();
     sj->sci = get_scintilla_object();
+    recorder_begin_activation(sj, "shortcut_line", 0);
     set_selection_info(sj);
     init_sj_values(sj);
 
@@ -102,6 +103,7 @@ void shortcut_line_init(ShortcutJump *sj) {
     gint lfs_added = 0;
     gint prev_line = sj->first_line_on_screen;
     gint indent_width = get_indent_width() - 1;
+    gint64 trace_start = trace_now();
 
     for (gint current_line = sj->first_line_on_screen; current_line < sj->last_line_on_screen; current_line++) {
         if (sj->words->len == shortcut_get_max_words(sj->config_settings->shortcuts_include_single_char)) {
@@ -114,19 +116,25 @@ void shortcut_line_init(ShortcutJump *sj) {
             break;
         }
 
-        Word word;
+        gchar c = scintilla_send_message(sj->sci, SCI_GETCHARAT, pos, TRUE);
+        Word word = {0};
 
-        word.word = g_string_new(sci_get_contents_range(sj->sci, pos, pos + 1));
+        word.length = 1;
         word.starting = pos + lfs_added;
         word.starting_doc = pos;
         word.is_hidden_neighbor = FALSE;
-        word.bytes = shortcut_get_utf8_char_length(word.word->str[0]);
-        word.shortcut = shortcut_make_tag(sj->config_settings->shortcuts_include_single_char,
-                                          sj->config_settings->shortcut_all_caps, sj->words->len);
+        word.bytes = utf8_scan_char_length(c);
+        word.shortcut_length = shortcut_make_tag(word.shortcut, sj->config_settings->shortcuts_include_single_char,
+                                                 sj->config_settings->shortcut_all_caps, sj->words->len);
         word.line = current_line;
         word.padding = 0;
 
-        gchar c = scintilla_send_message(sj->sci, SCI_GETCHARAT, pos, TRUE);
+        /* Drawn tags need no room made for them in the text */
+        if (sj->config_settings->label_overlay) {
+            g_array_append_val(sj->lf_positions, lfs_added);
+            g_array_append_val(sj->words, word);
+            continue;
+        }
 
         if (c == '\t') {
             for (gint i = 0; i < indent_width; i++) {
@@ -136,7 +144,7 @@ void shortcut_line_init(ShortcutJump *sj) {
             lfs_added += indent_width;
         }
 
-        if (word.shortcut->len == 1) {
+        if (word.shortcut_length == 1) {
             gchar first_char_on_line = scintilla_send_message(sj->sci, SCI_GETCHARAT, pos, TRUE);
 
             if (first_char_on_line == '\n') {
@@ -144,7 +152,7 @@ void shortcut_line_init(ShortcutJump *sj) {
             }
         }
 
-        if (word.shortcut->len == 2) {
+        if (word.shortcut_length == 2) {
             gchar first_char_on_line = scintilla_send_message(sj->sci, SCI_GETCHARAT, pos, TRUE);
             gchar next_char = scintilla_send_message(sj->sci, SCI_GETCHARAT, pos + 1, TRUE);
             gchar line_of_next_char = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, pos + 1, TRUE);
@@ -167,11 +175,15 @@ void shortcut_line_init(ShortcutJump *sj) {
         g_array_append_val(sj->lf_positions, lfs_added);
     }
 
-    sj->buffer = shortcut_mask_bytes(sj->words, sj->buffer, sj->first_position);
-    sj->buffer = shortcut_set_tags_in_buffer(sj->words, sj->buffer, sj->first_position);
+    if (!sj->config_settings->label_overlay) {
+        sj->buffer = shortcut_mask_bytes(sj->words, sj->buffer, sj->first_position);
+        sj->buffer = shortcut_set_tags_in_buffer(sj->words, sj->buffer, sj->first_position);
+    }
+
+    trace_record(TRACE_EXTRACTION, trace_start);
 
     shortcut_set_after_placement(sj);
-    shortcut_set_indicators(sj->sci, sj->words);
+    shortcut_set_indicators(sj);
     connect_key_press_action(sj, shortcut_line_on_key_press);
     connect_click_action(sj, shortcut_line_on_click_event);
     ui_set_statusbar(TRUE, _("%i line%s in view."), sj->words->len, sj->words->len == 1 ? "" : "s");
@@ -20,20 +20,20 @@
 
 #include "action_text_after.h"
 #include "annotation.h"
+#include "core/span.h"
+#include "core/utf8_scan.h"
 #include "jump_to_a_word.h"
+#include "recorder.h"
 #include "selection.h"
 #include "shortcut_common.h"
+#include "style_filter.h"
+#include "trace.h"
 #include "transpose_string.h"
 #include "util.h"
 #include "values.h"
 
 void shortcut_word_complete(ShortcutJump *sj, gint pos, gint word_length, gint line) {
-    scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETSTART, sj->first_position, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETEND, sj->first_position + sj->buffer->len, 0);
-    scintilla_send_message(sj->sci, SCI_REPLACETARGET, -1, (sptr_t)sj->cache->str);
-    scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
-    scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+    shortcut_remove_tags(sj);
 
     sj->previous_cursor_pos = sj->current_cursor_pos;
 
@@ -70,12 +70,7 @@ void shortcut_word_complete(ShortcutJump *sj, gint pos, gint word_length, gint l
 }
 
 void shortcut_word_cancel(ShortcutJump *sj) {
-    scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETSTART, sj->first_position, 0);
-    scintilla_send_message(sj->sci, SCI_SETTARGETEND, sj->first_position + sj->buffer->len, 0);
-    scintilla_send_message(sj->sci, SCI_REPLACETARGET, -1, (sptr_t)sj->cache->str);
-    scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
-    scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+    shortcut_remove_tags(sj);
     scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->current_cursor_pos, 0);
     shortcut_set_to_first_visible_line(sj);
     annotation_clear(sj->sci, sj->eol_message_line);
@@ -90,6 +85,9 @@ void shortcut_word_cancel(ShortcutJump *sj) {
 static gboolean shortcut_word_on_key_press(GtkWidget *widget, GdkEventKey *event, gpointer user_data) {
     ShortcutJump *sj = (ShortcutJump *)user_data;
 
+    sci_stats_begin_keystroke();
+    recorder_key(event);
+
     return shortcut_on_key_press_action(event, sj);
 }
 
@@ -108,10 +106,10 @@ static gboolean shortcut_word_on_click_event(GtkWidget *widget, GdkEventButton *
 
 static GString *shortcut_word_hide_word(const ShortcutJump *sj, GArray *words, GString *buffer, gint first_position) {
     for (gint i = 0; i < words->len; i++) {
-        Word word = g_array_index(words, Word, i);
-        gint starting = word.starting - first_position;
+        const Word *word = &g_array_index(words, Word, i);
+        gint starting = word->starting - first_position;
 
-        for (gint j = 0; j < word.word->len; j++) {
+        for (gint j = 0; j < word->length; j++) {
             buffer->str[starting + j] = ' ';
         }
     }
@@ -121,7 +119,12 @@ static GString *shortcut_word_hide_word(const ShortcutJump *sj, GArray *words, G
 
 void shortcut_word_init(ShortcutJump *sj) {
     sj->current_mode = JM_SHORTCUT_WORD;
+    sci_stats_begin_activation();
+    trace_begin_activation();
+    alloc_stats_begin_activation();
+    edit_stats_begin_activation();
     sj->sci = get_scintilla_object();
+    recorder_begin_activation(sj, "shortcut_word", 0);
     set_selection_info(sj);
     init_sj_values(sj);
 
@@ -131,73 +134,79 @@ void shortcut_word_init(ShortcutJump *sj) {
     gint prev_line;
 
     if (sj->in_selection && sj->config_settings->search_from_selection) {
-        prev_line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, sj->first_position, 0);
+        prev_line = get_line_from_position(sj, sj->first_position);
     } else {
         prev_line = sj->first_line_on_screen - 1;
     }
 
     gint lfs_added = 0;
+    gint64 trace_start = trace_now();
+    gint max_words = shortcut_get_max_words(sj->config_settings->shortcuts_include_single_char);
+    GArray *spans = g_array_new(FALSE, FALSE, sizeof(Span));
 
-    for (gint i = sj->first_position; i < sj->last_position; i++) {
-        if (sj->words->len == shortcut_get_max_words(sj->config_settings->shortcuts_include_single_char)) {
-            break;
-        }
-
-        gint start = scintilla_send_message(sj->sci, SCI_WORDSTARTPOSITION, i, TRUE);
-        gint end = scintilla_send_message(sj->sci, SCI_WORDENDPOSITION, i, TRUE);
+    get_view_word_spans(sj, sj->cache->str, spans);
+    style_filter_spans(sj, spans);
 
-        if (start == end || start < sj->first_position || end > sj->last_position) {
-            continue;
-        }
+    for (gint i = 0; i < spans->len && sj->words->len < max_words; i++) {
+        Span span = g_array_index(spans, Span, i);
+        gint start = sj->first_position + span.position;
+        gint end = start + span.length;
+        const gchar *word_text = sj->cache->str + span.position;
 
-        Word word;
+        Word word = {0};
 
-        word.word = g_string_new(sci_get_contents_range(sj->sci, start, end));
+        word.length = span.length;
         word.starting = start + lfs_added;
         word.starting_doc = start;
         word.is_hidden_neighbor = FALSE;
-        word.bytes = shortcut_get_utf8_char_length(word.word->str[0]);
-        word.shortcut = shortcut_make_tag(sj->config_settings->shortcuts_include_single_char,
-                                          sj->config_settings->shortcut_all_caps, sj->words->len);
-        word.line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, start, 0);
-        word.padding = shortcut_set_padding(sj, word.word->len);
+        word.shortcut_length = shortcut_make_tag(word.shortcut, sj->config_settings->shortcuts_include_single_char,
+                                                 sj->config_settings->shortcut_all_caps, sj->words->len);
+        word.line = get_line_from_position(sj, start);
+        word.padding = utf8_scan_char_start(word_text, shortcut_set_padding(sj, word.length));
+        word.bytes = utf8_scan_char_length(word_text[word.padding]);
 
-        gchar line_ending_char = scintilla_send_message(sj->sci, SCI_GETCHARAT, end, TRUE);
+        gchar line_ending_char = end < sj->last_position ? sj->cache->str[end - sj->first_position]
+                                                         : scintilla_send_message(sj->sci, SCI_GETCHARAT, end, TRUE);
 
-        if (line_ending_char == '\n' && word.word->len == 1 && word.shortcut->len == 2) {
+        if (line_ending_char == '\n' && word.length == 1 && word.shortcut_length == 2 &&
+            !sj->config_settings->label_overlay) {
             g_string_insert_c(sj->buffer, lfs_added + end - sj->first_position, '\n');
 
-            gint line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, i, 0);
-
-            if (line != prev_line) {
-                for (gint j = prev_line; j < line; j++) {
+            if (word.line != prev_line) {
+                for (gint j = prev_line; j < word.line; j++) {
                     g_array_append_val(sj->lf_positions, lfs_added);
                 }
 
-                prev_line = line;
+                prev_line = word.line;
             }
 
             lfs_added++;
         }
 
         g_array_append_val(sj->words, word);
-        i += word.word->len;
     }
 
+    g_array_free(spans, TRUE);
+
     for (gint i = prev_line; i < sj->last_line_on_screen; i++) {
         g_array_append_val(sj->lf_positions, lfs_added);
     }
 
-    sj->buffer = shortcut_mask_bytes(sj->words, sj->buffer, sj->first_position);
+    /* The label overlay draws the tags and hides the words itself, and never writes the buffer into the document */
+    if (!sj->config_settings->label_overlay) {
+        sj->buffer = shortcut_mask_bytes(sj->words, sj->buffer, sj->first_position);
+
+        if (sj->config_settings->hide_word_shortcut_jump) {
+            sj->buffer = shortcut_word_hide_word(sj, sj->words, sj->buffer, sj->first_position);
+        }
 
-    if (sj->config_settings->hide_word_shortcut_jump) {
-        sj->buffer = shortcut_word_hide_word(sj, sj->words, sj->buffer, sj->first_position);
+        sj->buffer = shortcut_set_tags_in_buffer(sj->words, sj->buffer, sj->first_position);
     }
 
-    sj->buffer = shortcut_set_tags_in_buffer(sj->words, sj->buffer, sj->first_position);
+    trace_record(TRACE_EXTRACTION, trace_start);
 
     shortcut_set_after_placement(sj);
-    shortcut_set_indicators(sj->sci, sj->words);
+    shortcut_set_indicators(sj);
     connect_key_press_action(sj, shortcut_word_on_key_press);
     connect_click_action(sj, shortcut_word_on_click_event);
     ui_set_statusbar(TRUE, _("%i word%s in view."), sj->words->len, sj->words->len == 1 ? "" : "s");
@@ -0,0 +1,139 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "core/span.h"
+#include "style_filter.h"
+#include "values.h"
+
+/*
+ * Keeps jump targets to the lexer style classes chosen in the preferences. The styles of the view are read with one
+ * SCI_GETSTYLEDTEXT the first time an activation asks for them, instead of a SCI_GETSTYLEAT for every target. A word
+ * search waiting on the document index has only the text the index has reached, and its styles are read up to there
+ * and then a batch at a time, so the whole document is not lexed before typing can start. The styled text is taken
+ * from the spare strings and given back when the activation ends, so a whole document of styles is not kept after it.
+ */
+
+static gboolean style_filter_is_allowed(TargetStyles target_styles, gint lexer, gint style) {
+    switch (target_styles) {
+    case TS_CODE:
+        return highlighting_is_code_style(lexer, style);
+    case TS_COMMENTS:
+        return highlighting_is_comment_style(lexer, style);
+    case TS_STRINGS:
+        return highlighting_is_string_style(lexer, style);
+    default:
+        return TRUE;
+    }
+}
+
+static void style_filter_load(ShortcutJump *sj) {
+    if (!sj->style_filter_loaded) {
+        gint lexer = scintilla_send_message(sj->sci, SCI_GETLEXER, 0, 0);
+
+        for (gint style = 0; style < 256; style++) {
+            sj->style_filter_allowed[style] = style_filter_is_allowed(sj->config_settings->target_styles, lexer, style);
+        }
+
+        sj->style_filter_end = sj->first_position;
+        sj->style_filter_loaded = TRUE;
+    }
+
+    gint start = sj->style_filter_end;
+    gint end = MAX(sj->document_index_pending ? sj->text_end : sj->last_position, start);
+    gint length = end - sj->first_position;
+
+    if (!sj->style_filter_text) {
+        sj->style_filter_text = take_string(sj, "", 0);
+    }
+
+    /* Each character is followed by its style, and the range ends with two zero bytes */
+    g_string_set_size(sj->style_filter_text, 2 * length + 2);
+    sj->style_filter_text->str[2 * length] = '\0';
+    sj->style_filter_text->str[2 * length + 1] = '\0';
+
+    if (end == start) {
+        return;
+    }
+
+    struct Sci_TextRange range;
+
+    range.chrg.cpMin = start;
+    range.chrg.cpMax = end;
+    range.lpstrText = sj->style_filter_text->str + 2 * (start - sj->first_position);
+
+    scintilla_send_message(sj->sci, SCI_COLOURISE, start, end);
+    scintilla_send_message(sj->sci, SCI_GETSTYLEDTEXT, 0, (sptr_t)&range);
+
+    sj->style_filter_end = end;
+}
+
+/* Whether a target at a position relative to the start of the view has one of the chosen styles */
+gboolean style_filter_allows(ShortcutJump *sj, gint position) {
+    if (sj->config_settings->target_styles == TS_ALL) {
+        return TRUE;
+    }
+
+    if (!sj->style_filter_loaded || sj->first_position + position >= sj->style_filter_end) {
+        style_filter_load(sj);
+    }
+
+    if (position < 0 || 2 * position + 1 >= sj->style_filter_text->len) {
+        return FALSE;
+    }
+
+    guchar style = sj->style_filter_text->str[2 * position + 1];
+    return sj->style_filter_allowed[style];
+}
+
+void style_filter_spans(ShortcutJump *sj, GArray *spans) {
+    if (sj->config_settings->target_styles == TS_ALL) {
+        return;
+    }
+
+    gint kept = 0;
+
+    for (gint i = 0; i < spans->len; i++) {
+        Span span = g_array_index(spans, Span, i);
+
+        if (style_filter_allows(sj, span.position)) {
+            g_array_index(spans, Span, kept++) = span;
+        }
+    }
+
+    g_array_set_size(spans, kept);
+}
+
+void style_filter_clear(ShortcutJump *sj) {
+    if (sj->style_filter_text) {
+        release_string(sj, sj->style_filter_text);
+        sj->style_filter_text = NULL;
+    }
+
+    sj->style_filter_loaded = FALSE;
+}
+
+void style_filter_free(ShortcutJump *sj) {
+    if (sj->style_filter_text) {
+        g_string_free(sj->style_filter_text, TRUE);
+        sj->style_filter_text = NULL;
+    }
+
+    style_filter_clear(sj);
+}
@@ -0,0 +1,93 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "jump_to_a_word.h"
+#include "trace.h"
+
+/*
+ * Keeps the timings of the most recent activation phases in a fixed ring buffer so that slow label placement can be
+ * attributed to tokenizing, buffer mutation or painting after the fact. Recording is two clock reads and a store.
+ */
+
+#define TRACE_BUFFER_SIZE 256
+
+typedef struct {
+    guint activation;
+    TracePhase phase;
+    gint64 offset;
+    gint64 duration;
+} TraceEvent;
+
+static const gchar *phase_names[TRACE_PHASE_COUNT] = {
+    [TRACE_SELECTION_INFO] = "selection info",
+    [TRACE_VIEW_POSITIONS] = "view positions",
+    [TRACE_EXTRACTION] = "extraction",
+    [TRACE_PLACEMENT] = "placement",
+    [TRACE_INDICATORS] = "indicators",
+    [TRACE_ANNOTATION] = "annotation",
+};
+
+static TraceEvent events[TRACE_BUFFER_SIZE];
+static guint events_next = 0;
+static guint events_count = 0;
+static guint activation = 0;
+static gint64 activation_start = 0;
+
+void trace_begin_activation(void) {
+    activation++;
+    activation_start = g_get_monotonic_time();
+}
+
+gint64 trace_now(void) { return g_get_monotonic_time(); }
+
+void trace_record(TracePhase phase, gint64 start) {
+    TraceEvent *event = &events[events_next];
+
+    event->activation = activation;
+    event->phase = phase;
+    event->offset = start - activation_start;
+    event->duration = g_get_monotonic_time() - start;
+
+    events_next = (events_next + 1) % TRACE_BUFFER_SIZE;
+    events_count = MIN(events_count + 1, TRACE_BUFFER_SIZE);
+}
+
+void trace_dump(void) {
+    if (events_count == 0) {
+        ui_set_statusbar(TRUE, _("The activation trace is empty."));
+        return;
+    }
+
+    guint first = (events_next + TRACE_BUFFER_SIZE - events_count) % TRACE_BUFFER_SIZE;
+
+    msgwin_status_add(_("Jump to a Word trace (%u phase%s, oldest first):"), events_count,
+                      events_count == 1 ? "" : "s");
+
+    for (guint i = 0; i < events_count; i++) {
+        const TraceEvent *event = &events[(first + i) % TRACE_BUFFER_SIZE];
+
+        msgwin_status_add("#%u %-14s +%8.3f ms %8.3f ms", event->activation, phase_names[event->phase],
+                          event->offset / 1000.0, event->duration / 1000.0);
+    }
+
+    msgwin_switch_tab(MSG_STATUS, TRUE);
+}
+
+void trace_dump_cb(GtkMenuItem *menu_item, gpointer user_data) { trace_dump(); }
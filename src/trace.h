@@ -0,0 +1,40 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <geanyplugin.h>
+
+typedef enum {
+    TRACE_SELECTION_INFO,
+    TRACE_VIEW_POSITIONS,
+    TRACE_EXTRACTION,
+    TRACE_PLACEMENT,
+    TRACE_INDICATORS,
+    TRACE_ANNOTATION,
+    TRACE_PHASE_COUNT,
+} TracePhase;
+
+void trace_begin_activation(void);
+gint64 trace_now(void);
+void trace_record(TracePhase phase, gint64 start);
+void trace_dump(void);
+void trace_dump_cb(GtkMenuItem *menu_item, gpointer user_data);
+
+#endif
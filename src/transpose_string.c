@@ -31,7 +31,7 @@ void multicursor_transpose_cancel(ShortcutJump *sj) {
         Word word = g_array_index(sj->multicursor_words, Word, i);
 
         scintilla_send_message(sj->sci, SCI_SETINDICATORCURRENT, INDICATOR_MULTICURSOR, 0);
-        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.word->len);
+        scintilla_send_message(sj->sci, SCI_INDICATORCLEARRANGE, word.starting, word.length);
     }
 
     toggle_multicursor_menu(sj, FALSE);
@@ -93,14 +93,20 @@ void transpose_string(ShortcutJump *sj, gboolean is_instant_transpose) {
         next_word = g_array_index(sj->multicursor_words, Word, first_valid);
     }
 
-    gint shift = next_word.starting_doc - word.word->len;
+    gint shift = next_word.starting_doc - word.length;
+    gchar *text = sci_get_contents_range(sj->sci, word.starting_doc, word.starting_doc + word.length);
+    gchar *next_text =
+        sci_get_contents_range(sj->sci, next_word.starting_doc, next_word.starting_doc + next_word.length);
 
     scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
     scintilla_send_message(sj->sci, SCI_BEGINUNDOACTION, 0, 0);
-    scintilla_send_message(sj->sci, SCI_DELETERANGE, word.starting_doc, word.word->len);
-    scintilla_send_message(sj->sci, SCI_DELETERANGE, shift, next_word.word->len);
-    scintilla_send_message(sj->sci, SCI_INSERTTEXT, word.starting_doc, (sptr_t)next_word.word->str);
-    scintilla_send_message(sj->sci, SCI_INSERTTEXT, shift + next_word.word->len, (sptr_t)word.word->str);
+    scintilla_send_message(sj->sci, SCI_DELETERANGE, word.starting_doc, word.length);
+    scintilla_send_message(sj->sci, SCI_DELETERANGE, shift, next_word.length);
+    scintilla_send_message(sj->sci, SCI_INSERTTEXT, word.starting_doc, (sptr_t)next_text);
+    scintilla_send_message(sj->sci, SCI_INSERTTEXT, shift + next_word.length, (sptr_t)text);
+
+    g_free(text);
+    g_free(next_text);
 
     multicursor_transpose_complete(sj);
 }
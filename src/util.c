@@ -18,6 +18,9 @@
 
 #include <plugindata.h>
 
+#include "core/tokenizer.h"
+#include "core/utf8_scan.h"
+#include "document_index.h"
 #include "duplicate_string.h"
 #include "insert_line.h"
 #include "jump_to_a_word.h"
@@ -31,6 +34,7 @@
 #include "shortcut_line.h"
 #include "shortcut_word.h"
 #include "values.h"
+#include "view_cache.h"
 
 void attempt_line_end_for_char(ShortcutJump *sj) {
     gint line_number = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, sj->current_cursor_pos, 0);
@@ -59,7 +63,7 @@ gint get_lfs(ShortcutJump *sj, gint current_line) {
     gint line;
 
     if (sj->in_selection && sj->config_settings->search_from_selection) {
-        line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, sj->first_position, 0) + 1;
+        line = get_line_from_position(sj, sj->first_position) + 1;
     } else {
         line = sj->first_line_on_screen;
     }
@@ -198,17 +202,13 @@ void end_actions(ShortcutJump *sj) {
     if (sj->current_mode == JM_SEARCH) {
         search_word_end(sj);
     } else if (sj->current_mode == JM_SHORTCUT_WORD) {
-        scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
-        scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
-        scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+        shortcut_remove_tags(sj);
         scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->current_cursor_pos, 0);
         shortcut_end(sj, FALSE);
     } else if (sj->current_mode == JM_REPLACE_SEARCH) {
         search_word_end(sj);
     } else if (sj->current_mode == JM_SHORTCUT_CHAR_JUMPING) {
-        scintilla_send_message(sj->sci, SCI_SETREADONLY, 0, 0);
-        scintilla_send_message(sj->sci, SCI_ENDUNDOACTION, 0, 0);
-        scintilla_send_message(sj->sci, SCI_UNDO, 0, 0);
+        shortcut_remove_tags(sj);
         scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->current_cursor_pos, 0);
         shortcut_end(sj, FALSE);
     } else if (sj->current_mode == JM_SHORTCUT_CHAR_ACCEPTING) {
@@ -239,6 +239,112 @@ void end_actions(ShortcutJump *sj) {
     }
 }
 
+/*
+ * The word characters of a document only change with its filetype, so they are read once for the current document
+ * and kept until the filetype is set again or another document is used.
+ */
+const WordChars *get_word_chars(ShortcutJump *sj) {
+    if (sj->word_chars_sci != sj->sci) {
+        gint length = scintilla_send_message(sj->sci, SCI_GETWORDCHARS, 0, 0);
+        gchar *chars = g_malloc(length + 1);
+
+        scintilla_send_message(sj->sci, SCI_GETWORDCHARS, 0, (sptr_t)chars);
+        chars[length] = '\0';
+        tokenizer_set_word_chars(&sj->word_chars, chars);
+        g_free(chars);
+
+        sj->word_chars_sci = sj->sci;
+    }
+
+    return &sj->word_chars;
+}
+
+void clear_word_chars(ShortcutJump *sj) { sj->word_chars_sci = NULL; }
+
+/*
+ * The character at position and, through width, the bytes it takes. Past the end of the document it is '\0', one
+ * byte wide.
+ */
+gunichar get_char_at(ScintillaObject *sci, gint position, gint *width) {
+    gint length = MIN(scintilla_send_message(sci, SCI_GETLENGTH, 0, 0) - position, 4);
+
+    if (position < 0 || length <= 0) {
+        *width = 1;
+        return '\0';
+    }
+
+    const gchar *text = (const gchar *)scintilla_send_message(sci, SCI_GETRANGEPOINTER, position, length);
+
+    return utf8_scan_decode(text, length, width);
+}
+
+/* The character that ends just before position, or '\0' at the start of the document */
+gunichar get_char_before(ScintillaObject *sci, gint position) {
+    gint length = MIN(position, 4);
+    gint width;
+
+    if (length <= 0) {
+        return '\0';
+    }
+
+    const gchar *text = (const gchar *)scintilla_send_message(sci, SCI_GETRANGEPOINTER, position - length, length);
+    gint start = utf8_scan_char_start(text, length - 1);
+
+    return utf8_scan_decode(text + start, length - start, &width);
+}
+
+/*
+ * Splits text, which holds the document from first_position to last_position, into the same words
+ * SCI_WORDSTARTPOSITION and SCI_WORDENDPOSITION would find, in one pass and without a message per position. Words cut
+ * by either end of the range are dropped.
+ */
+void get_word_spans(ShortcutJump *sj, const gchar *text, gint first_position, gint last_position, GArray *spans) {
+    gint length = last_position - first_position;
+
+    if (length <= 0) {
+        return;
+    }
+
+    const WordChars *word_chars = get_word_chars(sj);
+
+    tokenizer_scan(text, length, word_chars, spans);
+
+    if (spans->len > 0 && first_position > 0) {
+        Span first = g_array_index(spans, Span, 0);
+
+        if (first.position == 0 && tokenizer_is_word_char(word_chars, get_char_before(sj->sci, first_position))) {
+            g_array_remove_index(spans, 0);
+        }
+    }
+
+    if (spans->len > 0) {
+        Span last = g_array_index(spans, Span, spans->len - 1);
+        gint width;
+        gunichar after = get_char_at(sj->sci, last_position, &width);
+
+        if (last.position + last.length == length && after != '\0' && tokenizer_is_word_char(word_chars, after)) {
+            g_array_remove_index(spans, spans->len - 1);
+        }
+    }
+}
+
+/*
+ * The words of the view, read from the document index for a whole document search, or from the view cache when
+ * the view has not scrolled or changed since they were last found, and otherwise taken from text.
+ */
+void get_view_word_spans(ShortcutJump *sj, const gchar *text, GArray *spans) {
+    if (sj->last_position <= sj->first_position) {
+        return;
+    }
+
+    if (document_index_get_view_spans(sj, spans) || view_cache_lookup(sj, spans)) {
+        return;
+    }
+
+    get_word_spans(sj, text, sj->first_position, sj->last_position, spans);
+    view_cache_store(sj, sj->sci, sj->first_position, sj->last_position, spans);
+}
+
 gint sort_words_by_starting_doc(gconstpointer a, gconstpointer b) {
     const Word *struct_a = (const Word *)a;
     const Word *struct_b = (const Word *)b;
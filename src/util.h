@@ -35,6 +35,12 @@ gboolean mouse_movement_performed(ShortcutJump *sj, GdkEventButton *event);
 gboolean mod_key_pressed(GdkEventKey *event);
 void cancel_actions(ShortcutJump *sj);
 void end_actions(ShortcutJump *sj);
+const WordChars *get_word_chars(ShortcutJump *sj);
+void clear_word_chars(ShortcutJump *sj);
+gunichar get_char_at(ScintillaObject *sci, gint position, gint *width);
+gunichar get_char_before(ScintillaObject *sci, gint position);
+void get_word_spans(ShortcutJump *sj, const gchar *text, gint first_position, gint last_position, GArray *spans);
+void get_view_word_spans(ShortcutJump *sj, const gchar *text, GArray *spans);
 gint sort_words_by_starting_doc(gconstpointer a, gconstpointer b);
 void multicursor_menu_toggled(GtkMenuItem *menuitem, gpointer data);
 void whole_document_menu_toggled(GtkMenuItem *menuitem, gpointer data);
@@ -19,7 +19,12 @@
 #include <math.h>
 #include <plugindata.h>
 
+#include "core/line_index.h"
+#include "document_index.h"
 #include "jump_to_a_word.h"
+#include "selection.h"
+#include "style_filter.h"
+#include "trace.h"
 
 ScintillaObject *get_scintilla_object() {
     GeanyDocument *doc = document_get_current();
@@ -134,8 +139,89 @@ static gint get_cursor_position(ScintillaObject *sci, gint first_position, gint
     return current_cursor_pos;
 }
 
+/*
+ * The strings and arrays of an activation are emptied and kept when it ends instead of being freed, and the next
+ * activation takes them back with the memory they had grown to, so going through a mode does not call malloc once
+ * they are large enough. Spares holding more than SPARE_CAPACITY_LIMIT bytes, such as copies of a whole document,
+ * are freed so a single large activation does not stay resident.
+ */
+
+#define SPARE_COUNT_LIMIT 8
+#define SPARE_CAPACITY_LIMIT (1 << 20)
+
+GString *take_string(ShortcutJump *sj, const gchar *text, gint length) {
+    if (!sj->spare_strings || sj->spare_strings->len == 0) {
+        return g_string_new_len(text, length);
+    }
+
+    GString *string = g_ptr_array_steal_index_fast(sj->spare_strings, sj->spare_strings->len - 1);
+
+    g_string_append_len(string, text, length);
+    return string;
+}
+
+void release_string(ShortcutJump *sj, GString *string) {
+    if (!sj->spare_strings) {
+        sj->spare_strings = g_ptr_array_new();
+    }
+
+    if (sj->spare_strings->len == SPARE_COUNT_LIMIT || string->allocated_len > SPARE_CAPACITY_LIMIT) {
+        g_string_free(string, TRUE);
+        return;
+    }
+
+    g_string_truncate(string, 0);
+    g_ptr_array_add(sj->spare_strings, string);
+}
+
+static GArray *take_array(GPtrArray **spares, guint element_size) {
+    if (!*spares || (*spares)->len == 0) {
+        return g_array_new(FALSE, FALSE, element_size);
+    }
+
+    return g_ptr_array_steal_index_fast(*spares, (*spares)->len - 1);
+}
+
+static void release_array(GPtrArray **spares, GArray *array) {
+    if (!*spares) {
+        *spares = g_ptr_array_new();
+    }
+
+    if ((*spares)->len == SPARE_COUNT_LIMIT ||
+        (gsize)g_array_get_element_size(array) * array->len > SPARE_CAPACITY_LIMIT) {
+        g_array_free(array, TRUE);
+        return;
+    }
+
+    g_array_set_size(array, 0);
+    g_ptr_array_add(*spares, array);
+}
+
+static void free_spares(GPtrArray **spares, gboolean strings) {
+    if (!*spares) {
+        return;
+    }
+
+    for (gint i = 0; i < (*spares)->len; i++) {
+        if (strings) {
+            g_string_free(g_ptr_array_index(*spares, i), TRUE);
+        } else {
+            g_array_free(g_ptr_array_index(*spares, i), TRUE);
+        }
+    }
+
+    g_ptr_array_free(*spares, TRUE);
+    *spares = NULL;
+}
+
+void free_spare_values(ShortcutJump *sj) {
+    free_spares(&sj->spare_strings, TRUE);
+    free_spares(&sj->spare_words, FALSE);
+    free_spares(&sj->spare_positions, FALSE);
+}
+
 static GArray *markers_margin_get(ShortcutJump *sj, gint first_line_on_screen, gint lines_on_screen) {
-    GArray *markers = g_array_new(FALSE, FALSE, sizeof(gint));
+    GArray *markers = take_array(&sj->spare_positions, sizeof(gint));
 
     if (sj->current_mode == JM_SHORTCUT_WORD || sj->current_mode == JM_SHORTCUT_CHAR_JUMPING) {
         if (sj->range_is_set) {
@@ -192,18 +278,41 @@ static gint get_wrapped_lines(ScintillaObject *sci, gint first_line_on_screen) {
     return wrapped_lines;
 }
 
-void get_view_positions(ShortcutJump *sj) {
-    gint first_line_on_screen;
-    gint lines_on_screen;
-
+static void get_view_lines(ShortcutJump *sj, gint *first_line_on_screen, gint *lines_on_screen) {
     if (sj->current_mode != JM_SHORTCUT_WORD && sj->current_mode != JM_SHORTCUT_CHAR_ACCEPTING &&
         sj->current_mode != JM_LINE && sj->config_settings->whole_document) {
-        first_line_on_screen = 0;
-        lines_on_screen = scintilla_send_message(sj->sci, SCI_GETLINECOUNT, 0, 0);
+        *first_line_on_screen = 0;
+        *lines_on_screen = scintilla_send_message(sj->sci, SCI_GETLINECOUNT, 0, 0);
     } else {
-        first_line_on_screen = get_first_line_on_screen(sj);
-        lines_on_screen = get_number_of_lines_on_screen(sj);
+        *first_line_on_screen = get_first_line_on_screen(sj);
+        *lines_on_screen = get_number_of_lines_on_screen(sj);
     }
+}
+
+/*
+ * The range an activation of a mode would take with the current view and selection, found by the same rules as
+ * get_view_positions for work done ahead of the activation.
+ */
+void get_view_range(ShortcutJump *sj, JumpMode mode, gint *first_position, gint *last_position) {
+    JumpMode current_mode = sj->current_mode;
+    gint first_line_on_screen;
+    gint lines_on_screen;
+
+    sj->current_mode = mode;
+    read_selection_info(sj);
+    get_view_lines(sj, &first_line_on_screen, &lines_on_screen);
+
+    *first_position = get_first_position(sj, first_line_on_screen);
+    *last_position = get_last_position(sj, first_line_on_screen + lines_on_screen);
+
+    sj->current_mode = current_mode;
+}
+
+void get_view_positions(ShortcutJump *sj) {
+    gint first_line_on_screen;
+    gint lines_on_screen;
+
+    get_view_lines(sj, &first_line_on_screen, &lines_on_screen);
 
     gint last_line_on_screen = first_line_on_screen + lines_on_screen;
     gint first_position = get_first_position(sj, first_line_on_screen);
@@ -221,8 +330,36 @@ void get_view_positions(ShortcutJump *sj) {
     sj->cursor_moved_to_eol = current_cursor_pos;
 }
 
+/*
+ * Lines of positions in the view are looked up in a table of line starts built from the text taken at activation.
+ * The table is dropped on the first edit to the document, after which lookups go back to Scintilla.
+ */
+void set_line_starts(ShortcutJump *sj, const gchar *text, gint length) {
+    if (!sj->line_starts) {
+        sj->line_starts = g_array_new(FALSE, FALSE, sizeof(gint));
+    }
+
+    line_index_build(sj->line_starts, text, length);
+    sj->line_starts_first_line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, sj->first_position, 0);
+}
+
+void clear_line_starts(ShortcutJump *sj) {
+    if (sj->line_starts) {
+        g_array_free(sj->line_starts, TRUE);
+        sj->line_starts = NULL;
+    }
+}
+
+gint get_line_from_position(ShortcutJump *sj, gint pos) {
+    if (sj->line_starts && pos >= sj->first_position && pos <= sj->last_position) {
+        return sj->line_starts_first_line + line_index_lookup(sj->line_starts, pos - sj->first_position);
+    }
+
+    return scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, pos, 0);
+}
+
 static void set_common_vals(ShortcutJump *sj) {
-    sj->eol_message_line = scintilla_send_message(sj->sci, SCI_LINEFROMPOSITION, sj->current_cursor_pos, 0);
+    sj->eol_message_line = get_line_from_position(sj, sj->current_cursor_pos);
     sj->shortcut_single_pos = 0;
     sj->search_results_count = 0;
     sj->search_word_pos = -1;
@@ -232,61 +369,122 @@ static void set_common_vals(ShortcutJump *sj) {
     sj->replace_len = 0;
     sj->replace_instant = FALSE;
     sj->inserting_clipboard = FALSE;
+    sj->document_index_pending = FALSE;
 }
 
+/*
+ * Gives the values of an activation back to the spares. The pointers are cleared so anything that uses them after the
+ * activation has ended fails instead of writing into strings and arrays the next activation will be handed.
+ */
 void free_sj_values(ShortcutJump *sj) {
-    g_string_free(sj->cache, TRUE);
-    g_string_free(sj->buffer, TRUE);
-    g_string_free(sj->replace_cache, TRUE);
-
-    g_string_free(sj->eol_message, TRUE);
-    g_string_free(sj->search_query, TRUE);
+    release_string(sj, sj->cache);
+    release_string(sj, sj->buffer);
+    release_string(sj, sj->replace_cache);
+    sj->cache = NULL;
+    sj->buffer = NULL;
+    sj->replace_cache = NULL;
+    sj->text_end = 0;
+
+    release_string(sj, sj->eol_message);
+    release_string(sj, sj->search_query);
+    sj->eol_message = NULL;
+    sj->search_query = NULL;
 
     g_free(sj->clipboard_text);
-    g_string_free(sj->replace_query, TRUE);
+    release_string(sj, sj->replace_query);
+    sj->clipboard_text = NULL;
+    sj->replace_query = NULL;
+
+    release_array(&sj->spare_positions, sj->lf_positions);
+    release_array(&sj->spare_words, sj->words);
+    release_array(&sj->spare_positions, sj->markers);
+    sj->lf_positions = NULL;
+    sj->words = NULL;
+    sj->markers = NULL;
+
+    clear_line_starts(sj);
+    style_filter_clear(sj);
+    set_common_vals(sj);
 
-    g_array_free(sj->lf_positions, TRUE);
-    g_array_free(sj->words, TRUE);
-    g_array_free(sj->markers, TRUE);
+    alloc_stats_report("free_sj_values");
+}
 
-    set_common_vals(sj);
+/* A range running to the end of a document that does not end with a newline is given one in the buffer */
+static void end_buffer_line(ShortcutJump *sj) {
+    gint chars_in_doc = scintilla_send_message(sj->sci, SCI_GETLENGTH, 0, 0);
+    gchar last_char = scintilla_send_message(sj->sci, SCI_GETCHARAT, sj->last_position - 1, 0);
+
+    if (chars_in_doc == sj->last_position && last_char != '\n') {
+        g_string_append_c(sj->buffer, '\n');
+    }
+}
+
+/*
+ * Copies the text of the range up to a position into the strings of the activation. A word search over a whole
+ * document the index is still being built for starts with them empty and is given the text a batch at a time along
+ * with the words, so the document is not copied before typing can start. Lines are then looked up in Scintilla.
+ */
+void load_sj_text(ShortcutJump *sj, gint position) {
+    gint chars_in_doc = scintilla_send_message(sj->sci, SCI_GETLENGTH, 0, 0);
+    gint end = MIN(MIN(position, sj->last_position), chars_in_doc);
+
+    if (end <= sj->text_end) {
+        return;
+    }
+
+    gint length = end - sj->text_end;
+    const gchar *text = (const gchar *)scintilla_send_message(sj->sci, SCI_GETRANGEPOINTER, sj->text_end, length);
+
+    g_string_append_len(sj->cache, text, length);
+    g_string_append_len(sj->buffer, text, length);
+    g_string_append_len(sj->replace_cache, text, length);
+    sj->text_end = end;
+
+    if (end == sj->last_position) {
+        end_buffer_line(sj);
+    }
 }
 
 void init_sj_values(ShortcutJump *sj) {
+    gint64 trace_start = trace_now();
+
+    style_filter_clear(sj);
     get_view_positions(sj);
 
-    gchar *screen_lines;
+    gboolean deferred = document_index_defers_text(sj);
+    gint length = deferred ? 0 : MAX(sj->last_position - sj->first_position, 0);
+    const gchar *screen_lines = "";
 
-    if (sj->first_position < sj->last_position) {
-        screen_lines = sci_get_contents_range(sj->sci, sj->first_position, sj->last_position);
-    } else {
-        screen_lines = g_strdup("");
+    if (length > 0) {
+        screen_lines = (const gchar *)scintilla_send_message(sj->sci, SCI_GETRANGEPOINTER, sj->first_position, length);
     }
 
-    sj->cache = g_string_new(screen_lines);
-    sj->buffer = g_string_new(screen_lines);
-    sj->replace_cache = g_string_new(screen_lines);
+    sj->cache = take_string(sj, screen_lines, length);
+    sj->buffer = take_string(sj, screen_lines, length);
+    sj->replace_cache = take_string(sj, screen_lines, length);
+    sj->text_end = sj->first_position + length;
 
-    g_free(screen_lines);
+    if (!deferred) {
+        set_line_starts(sj, sj->cache->str, sj->cache->len);
+    }
 
-    sj->eol_message = g_string_new("");
-    sj->search_query = g_string_new("");
+    sj->eol_message = take_string(sj, "", 0);
+    sj->search_query = take_string(sj, "", 0);
 
     sj->clipboard_text = g_strdup("");
-    sj->replace_query = g_string_new("");
+    sj->replace_query = take_string(sj, "", 0);
 
-    sj->lf_positions = g_array_new(FALSE, FALSE, sizeof(gint));
-    sj->words = g_array_new(FALSE, FALSE, sizeof(Word));
+    sj->lf_positions = take_array(&sj->spare_positions, sizeof(gint));
+    sj->words = take_array(&sj->spare_words, sizeof(Word));
     sj->markers = markers_margin_get(sj, sj->first_line_on_screen, sj->lines_on_screen);
 
     set_common_vals(sj);
 
-    gint chars_in_doc = scintilla_send_message(sj->sci, SCI_GETLENGTH, 0, 0);
-    gchar last_char = scintilla_send_message(sj->sci, SCI_GETCHARAT, sj->last_position - 1, 0);
-
-    if (chars_in_doc == sj->last_position && last_char != '\n') {
-        g_string_append_c(sj->buffer, '\n');
+    if (!deferred) {
+        end_buffer_line(sj);
     }
 
+    trace_record(TRACE_VIEW_POSITIONS, trace_start);
+
     // scintilla_send_message(sj->sci, SCI_GOTOPOS, sj->current_cursor_pos, 0);
 }
@@ -22,9 +22,17 @@
 #include "jump_to_a_word.h"
 
 void init_sj_values(ShortcutJump *sj);
+void load_sj_text(ShortcutJump *sj, gint position);
 ScintillaObject *get_scintilla_object();
 void margin_markers_reset(ShortcutJump *sj);
+void get_view_range(ShortcutJump *sj, JumpMode mode, gint *first_position, gint *last_position);
 void get_view_positions(ShortcutJump *sj);
 void free_sj_values(ShortcutJump *sj);
+void free_spare_values(ShortcutJump *sj);
+GString *take_string(ShortcutJump *sj, const gchar *text, gint length);
+void release_string(ShortcutJump *sj, GString *string);
+void set_line_starts(ShortcutJump *sj, const gchar *text, gint length);
+void clear_line_starts(ShortcutJump *sj);
+gint get_line_from_position(ShortcutJump *sj, gint pos);
 
 #endif
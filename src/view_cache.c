@@ -0,0 +1,68 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "view_cache.h"
+
+/*
+ * The words last found for a range of a document, kept with the range and the document version they came from.
+ * Chained and repeated activations over a view that has not scrolled or changed take them instead of tokenizing the
+ * view again. The version counts the edits reported through editor-notify, and the shortcut modes put it back when
+ * they undo their tags, since the text is then what it was.
+ */
+
+void view_cache_store(ShortcutJump *sj, ScintillaObject *sci, gint first_position, gint last_position,
+                      const GArray *spans) {
+    if (!sj->view_cache_spans) {
+        sj->view_cache_spans = g_array_new(FALSE, FALSE, sizeof(Span));
+    }
+
+    g_array_set_size(sj->view_cache_spans, 0);
+    g_array_append_vals(sj->view_cache_spans, spans->data, spans->len);
+
+    sj->view_cache_sci = sci;
+    sj->view_cache_first_position = first_position;
+    sj->view_cache_last_position = last_position;
+    sj->view_cache_version = sj->document_version;
+}
+
+gboolean view_cache_is_current(ShortcutJump *sj, ScintillaObject *sci, gint first_position, gint last_position) {
+    return sj->view_cache_sci == sci && sj->view_cache_version == sj->document_version &&
+           sj->view_cache_first_position == first_position && sj->view_cache_last_position == last_position;
+}
+
+gboolean view_cache_lookup(ShortcutJump *sj, GArray *spans) {
+    if (!view_cache_is_current(sj, sj->sci, sj->first_position, sj->last_position)) {
+        return FALSE;
+    }
+
+    g_array_append_vals(spans, sj->view_cache_spans->data, sj->view_cache_spans->len);
+    return TRUE;
+}
+
+void view_cache_clear(ShortcutJump *sj) { sj->view_cache_sci = NULL; }
+
+void view_cache_free(ShortcutJump *sj) {
+    if (sj->view_cache_spans) {
+        g_array_free(sj->view_cache_spans, TRUE);
+        sj->view_cache_spans = NULL;
+    }
+
+    view_cache_clear(sj);
+}
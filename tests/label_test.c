@@ -0,0 +1,67 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include <glib.h>
+
+#include "core/label.h"
+#include "label_test.h"
+
+static void label_test_expect(gint position, gboolean include_single_char, gboolean all_caps, const gchar *expected) {
+    gchar buffer[LABEL_MAX_LENGTH];
+    gint length = label_format(buffer, include_single_char, all_caps, position);
+
+    g_assert_cmpint(length, ==, strlen(expected));
+    g_assert_cmpstr(buffer, ==, expected);
+}
+
+static void label_test_single_char(void) {
+    label_test_expect(0, TRUE, FALSE, "a");
+    label_test_expect(25, TRUE, FALSE, "z");
+    label_test_expect(26, TRUE, FALSE, "aa");
+    label_test_expect(27, TRUE, FALSE, "ab");
+    label_test_expect(701, TRUE, FALSE, "zz");
+    label_test_expect(702, TRUE, FALSE, "aaa");
+}
+
+static void label_test_without_single_char(void) {
+    label_test_expect(0, FALSE, FALSE, "aa");
+    label_test_expect(675, FALSE, FALSE, "zz");
+    label_test_expect(676, FALSE, FALSE, "aaa");
+}
+
+static void label_test_all_caps(void) {
+    label_test_expect(0, TRUE, TRUE, "A");
+    label_test_expect(27, TRUE, TRUE, "AB");
+    label_test_expect(0, FALSE, TRUE, "AA");
+}
+
+static void label_test_limits(void) {
+    gchar buffer[LABEL_MAX_LENGTH];
+
+    g_assert_cmpint(label_format(buffer, TRUE, FALSE, -1), ==, 0);
+    label_test_expect(G_MAXINT, TRUE, FALSE, "fxshrxx");
+}
+
+void label_test_add(void) {
+    g_test_add_func("/core/label/single-char", label_test_single_char);
+    g_test_add_func("/core/label/without-single-char", label_test_without_single_char);
+    g_test_add_func("/core/label/all-caps", label_test_all_caps);
+    g_test_add_func("/core/label/limits", label_test_limits);
+}
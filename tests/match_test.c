@@ -0,0 +1,145 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include <glib.h>
+
+#include "core/match.h"
+#include "match_test.h"
+
+static const MatchOptions case_sensitive = {.case_sensitive = TRUE, .from_beginning = TRUE};
+static const MatchOptions caseless = {.from_beginning = TRUE};
+static const MatchOptions smart_case = {.case_sensitive = TRUE, .smart_case = TRUE, .from_beginning = TRUE};
+static const MatchOptions whole_word = {.whole_word = TRUE};
+
+static gboolean match_test_word(const gchar *word, const gchar *query, const MatchOptions *options) {
+    return match_word(word, strlen(word), query, strlen(query), options);
+}
+
+static void match_test_expect_positions(const gchar *haystack, gint length, const gchar *query,
+                                        const MatchOptions *options, const gint *expected, gint count) {
+    GArray *positions = g_array_new(FALSE, FALSE, sizeof(gint));
+
+    match_substrings(haystack, length, query, strlen(query), options, positions);
+
+    g_assert_cmpint(positions->len, ==, count);
+
+    for (gint i = 0; i < count; i++) {
+        g_assert_cmpint(g_array_index(positions, gint, i), ==, expected[i]);
+    }
+
+    g_array_free(positions, TRUE);
+}
+
+static void match_test_word_case_sensitive(void) {
+    MatchOptions anywhere = case_sensitive;
+
+    anywhere.from_beginning = FALSE;
+
+    g_assert_true(match_test_word("Foobar", "Foo", &case_sensitive));
+    g_assert_false(match_test_word("Foobar", "foo", &case_sensitive));
+    g_assert_false(match_test_word("Fo", "Foo", &case_sensitive));
+    g_assert_true(match_test_word("xFoo", "Foo", &anywhere));
+    g_assert_false(match_test_word("xfoo", "Foo", &anywhere));
+}
+
+static void match_test_word_caseless(void) {
+    MatchOptions anywhere = caseless;
+
+    anywhere.from_beginning = FALSE;
+
+    g_assert_true(match_test_word("FOOBAR", "foo", &caseless));
+    g_assert_false(match_test_word("xFOO", "foo", &caseless));
+    g_assert_true(match_test_word("xFOO", "foo", &anywhere));
+}
+
+static void match_test_word_smart_case(void) {
+    g_assert_true(match_test_word("FooBar", "foo", &smart_case));
+    g_assert_true(match_test_word("foobar", "foo", &smart_case));
+    g_assert_true(match_test_word("FooBar", "Foo", &smart_case));
+    g_assert_false(match_test_word("foobar", "Foo", &smart_case));
+    g_assert_false(match_test_word("fob", "foo", &smart_case));
+}
+
+/* The word is the start of a longer buffer that goes on to complete the query, which must not be read */
+static void match_test_word_smart_case_short_word(void) {
+    const gchar *buffer = "abc";
+
+    g_assert_false(match_word(buffer, 2, "abc", 3, &smart_case));
+    g_assert_false(match_word(buffer, 0, "a", 1, &smart_case));
+}
+
+static void match_test_word_whole_word(void) {
+    g_assert_true(match_test_word("foo", "foo", &whole_word));
+    g_assert_false(match_test_word("foobar", "foo", &whole_word));
+    g_assert_false(match_test_word("Foo", "foo", &whole_word));
+    g_assert_false(match_word("foobar", 3, "foob", 4, &whole_word));
+}
+
+static void match_test_substrings_case_sensitive(void) {
+    const gint expected[] = {0, 2};
+    const gint mixed[] = {4};
+
+    match_test_expect_positions("aaaa", 4, "aa", &case_sensitive, expected, G_N_ELEMENTS(expected));
+    match_test_expect_positions("Foo foo FOO", 11, "foo", &case_sensitive, mixed, G_N_ELEMENTS(mixed));
+}
+
+static void match_test_substrings_caseless(void) {
+    const gint expected[] = {0, 4, 8};
+
+    match_test_expect_positions("Foo foo FOO", 11, "foo", &caseless, expected, G_N_ELEMENTS(expected));
+}
+
+static void match_test_substrings_smart_case(void) {
+    const gint lower[] = {3, 7};
+    const gint upper[] = {4};
+    const gint overlapping[] = {0, 1, 2};
+
+    match_test_expect_positions("fooBar bar", 10, "bar", &smart_case, lower, G_N_ELEMENTS(lower));
+    match_test_expect_positions("bar Bar", 7, "Bar", &smart_case, upper, G_N_ELEMENTS(upper));
+    match_test_expect_positions("aaaa", 4, "aa", &smart_case, overlapping, G_N_ELEMENTS(overlapping));
+}
+
+/* A match ending at the last byte is found, and one that would need the byte after the range is not */
+static void match_test_substrings_range_end(void) {
+    const gint expected[] = {3};
+
+    match_test_expect_positions("fooBar", 6, "bar", &smart_case, expected, G_N_ELEMENTS(expected));
+    match_test_expect_positions("fooBar", 5, "bar", &smart_case, NULL, 0);
+    match_test_expect_positions("foobar", 5, "bar", &case_sensitive, NULL, 0);
+    match_test_expect_positions("foobar", 5, "BAR", &caseless, NULL, 0);
+}
+
+static void match_test_substrings_empty_query(void) {
+    match_test_expect_positions("foo", 3, "", &case_sensitive, NULL, 0);
+    match_test_expect_positions("foo", 3, "", &smart_case, NULL, 0);
+}
+
+void match_test_add(void) {
+    g_test_add_func("/core/match/word/case-sensitive", match_test_word_case_sensitive);
+    g_test_add_func("/core/match/word/caseless", match_test_word_caseless);
+    g_test_add_func("/core/match/word/smart-case", match_test_word_smart_case);
+    g_test_add_func("/core/match/word/smart-case-short-word", match_test_word_smart_case_short_word);
+    g_test_add_func("/core/match/word/whole-word", match_test_word_whole_word);
+    g_test_add_func("/core/match/substrings/case-sensitive", match_test_substrings_case_sensitive);
+    g_test_add_func("/core/match/substrings/caseless", match_test_substrings_caseless);
+    g_test_add_func("/core/match/substrings/smart-case", match_test_substrings_smart_case);
+    g_test_add_func("/core/match/substrings/range-end", match_test_substrings_range_end);
+    g_test_add_func("/core/match/substrings/empty-query", match_test_substrings_empty_query);
+}
@@ -0,0 +1,69 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <plugindata.h>
+
+#include "harness.h"
+#include "repeat_action.h"
+#include "repeat_action_test.h"
+#include "sci_stub.h"
+
+static void repeat_action_test_set_previous(ShortcutJump *sj, JumpMode mode, const gchar *search,
+                                            const gchar *replace) {
+    if (sj->has_previous_action) {
+        g_string_free(sj->previous_search_query, TRUE);
+        g_string_free(sj->previous_replace_query, TRUE);
+    }
+
+    sj->previous_search_query = g_string_new(search);
+    sj->previous_replace_query = g_string_new(replace);
+    sj->previous_mode = mode;
+    sj->previous_replace_action = RA_REPLACE;
+    sj->has_previous_action = TRUE;
+}
+
+/*
+ * A word search over the whole document leaves the document indexed, the document then grows, and the replacement is
+ * repeated. The repeat reads the grown document itself, so none of the previous search's text may be added to it.
+ */
+static void repeat_action_test_whole_document_grown(void) {
+    const BenchContext context = {0};
+    ScintillaObject *sci = sci_stub_new("alpha beta alpha\n");
+    const BenchMode *search = bench_find_mode("search_word_get_words");
+    ShortcutJump *sj;
+
+    sci_stub_set_current(sci);
+    sci_stub_set_view(sci, 0, 10);
+    sj = bench_new_sj(TRUE);
+
+    search->activate(sj, &context);
+    search->finish(sj, &context);
+
+    scintilla_send_message(sci, SCI_INSERTTEXT, sci_stub_get_length(sci), (sptr_t) "gamma alpha\n");
+    repeat_action_test_set_previous(sj, JM_REPLACE_SEARCH, "alpha", "omega");
+    repeat_action_kb(NULL, 0, sj);
+
+    g_assert_cmpstr(sci_stub_get_text(sci), ==, "omega beta omega\ngamma omega\n");
+
+    bench_free_sj(sj);
+    sci_stub_free(sci);
+}
+
+void repeat_action_test_add(void) {
+    g_test_add_func("/plugin/repeat-action/whole-document-grown", repeat_action_test_whole_document_grown);
+}
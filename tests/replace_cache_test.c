@@ -0,0 +1,133 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <glib.h>
+
+#include "core/replace_cache.h"
+#include "replace_cache_test.h"
+
+static GArray *replace_cache_test_spans(const Span *spans, gint count) {
+    GArray *array = g_array_new(FALSE, FALSE, sizeof(Span));
+
+    g_array_append_vals(array, spans, count);
+    return array;
+}
+
+static void replace_cache_test_expect_positions(GArray *spans, const gint *expected, gint count) {
+    g_assert_cmpint(spans->len, ==, count);
+
+    for (gint i = 0; i < count; i++) {
+        g_assert_cmpint(g_array_index(spans, Span, i).position, ==, expected[i]);
+    }
+}
+
+static void replace_cache_test_insert(void) {
+    const Span matches[] = {{0, 1}, {2, 1}, {4, 1}};
+    const gint after[] = {0, 3, 6};
+    GString *cache = g_string_new("a-a-a");
+    GArray *spans = replace_cache_test_spans(matches, G_N_ELEMENTS(matches));
+
+    replace_cache_insert(cache, spans, 1, "X", 1);
+
+    g_assert_cmpstr(cache->str, ==, "aX-aX-aX");
+    replace_cache_test_expect_positions(spans, after, G_N_ELEMENTS(after));
+
+    g_array_free(spans, TRUE);
+    g_string_free(cache, TRUE);
+}
+
+static void replace_cache_test_insert_at_start(void) {
+    const Span matches[] = {{0, 3}, {4, 3}};
+    const gint after[] = {0, 6};
+    GString *cache = g_string_new("foo foo");
+    GArray *spans = replace_cache_test_spans(matches, G_N_ELEMENTS(matches));
+
+    replace_cache_insert(cache, spans, 0, "xy", 2);
+
+    g_assert_cmpstr(cache->str, ==, "xyfoo xyfoo");
+    replace_cache_test_expect_positions(spans, after, G_N_ELEMENTS(after));
+
+    g_array_free(spans, TRUE);
+    g_string_free(cache, TRUE);
+}
+
+static void replace_cache_test_erase(void) {
+    const Span matches[] = {{0, 2}, {3, 2}, {6, 2}};
+    const gint after[] = {0, 2, 4};
+    GString *cache = g_string_new("aX-aX-aX");
+    GArray *spans = replace_cache_test_spans(matches, G_N_ELEMENTS(matches));
+
+    g_assert_true(replace_cache_erase(cache, spans, 1, 1));
+
+    g_assert_cmpstr(cache->str, ==, "a-a-a");
+    replace_cache_test_expect_positions(spans, after, G_N_ELEMENTS(after));
+
+    g_array_free(spans, TRUE);
+    g_string_free(cache, TRUE);
+}
+
+/* The last match has one byte after the offset, so erasing two is rejected and nothing is changed */
+static void replace_cache_test_erase_rejected(void) {
+    const Span matches[] = {{0, 2}, {3, 2}};
+    const gint after[] = {0, 3};
+    GString *cache = g_string_new("ab-ab");
+    GArray *spans = replace_cache_test_spans(matches, G_N_ELEMENTS(matches));
+
+    g_assert_false(replace_cache_erase(cache, spans, 1, 2));
+
+    g_assert_cmpstr(cache->str, ==, "ab-ab");
+    replace_cache_test_expect_positions(spans, after, G_N_ELEMENTS(after));
+
+    g_array_free(spans, TRUE);
+    g_string_free(cache, TRUE);
+}
+
+static void replace_cache_test_erase_without_spans(void) {
+    GString *cache = g_string_new("abc");
+    GArray *spans = g_array_new(FALSE, FALSE, sizeof(Span));
+
+    g_assert_true(replace_cache_erase(cache, spans, 0, 1));
+    g_assert_cmpstr(cache->str, ==, "abc");
+
+    g_array_free(spans, TRUE);
+    g_string_free(cache, TRUE);
+}
+
+static void replace_cache_test_erase_spans(void) {
+    const Span matches[] = {{0, 3}, {8, 3}};
+    const gint after[] = {0, 5};
+    GString *cache = g_string_new("foo bar foo");
+    GArray *spans = replace_cache_test_spans(matches, G_N_ELEMENTS(matches));
+
+    replace_cache_erase_spans(cache, spans);
+
+    g_assert_cmpstr(cache->str, ==, " bar ");
+    replace_cache_test_expect_positions(spans, after, G_N_ELEMENTS(after));
+
+    g_array_free(spans, TRUE);
+    g_string_free(cache, TRUE);
+}
+
+void replace_cache_test_add(void) {
+    g_test_add_func("/core/replace-cache/insert", replace_cache_test_insert);
+    g_test_add_func("/core/replace-cache/insert-at-start", replace_cache_test_insert_at_start);
+    g_test_add_func("/core/replace-cache/erase", replace_cache_test_erase);
+    g_test_add_func("/core/replace-cache/erase-rejected", replace_cache_test_erase_rejected);
+    g_test_add_func("/core/replace-cache/erase-without-spans", replace_cache_test_erase_without_spans);
+    g_test_add_func("/core/replace-cache/erase-spans", replace_cache_test_erase_spans);
+}
@@ -0,0 +1,175 @@
+/*
+   Jump to a Word - Move the cursor to a word in Geany
+   Copyright (C) 2025 01mu <github.com/01mu>
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include <glib.h>
+
+#include "core/tokenizer.h"
+#include "tokenizer_test.h"
+
+#define TOKENIZER_TEST_WORD_CHARS "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"
+
+static void tokenizer_test_expect(const gchar *text, gint length, const Span *expected, gint count) {
+    WordChars word_chars;
+    GArray *spans = g_array_new(FALSE, FALSE, sizeof(Span));
+
+    tokenizer_set_word_chars(&word_chars, TOKENIZER_TEST_WORD_CHARS);
+    tokenizer_scan(text, length, &word_chars, spans);
+
+    g_assert_cmpint(spans->len, ==, count);
+
+    for (gint i = 0; i < count; i++) {
+        g_assert_cmpint(g_array_index(spans, Span, i).position, ==, expected[i].position);
+        g_assert_cmpint(g_array_index(spans, Span, i).length, ==, expected[i].length);
+    }
+
+    g_array_free(spans, TRUE);
+}
+
+static void tokenizer_test_range_edges(void) {
+    const Span whole[] = {{0, 3}, {4, 3}};
+    const Span cut[] = {{0, 3}, {4, 1}};
+    const Span inner[] = {{1, 3}};
+
+    tokenizer_test_expect("foo bar", 7, whole, G_N_ELEMENTS(whole));
+    tokenizer_test_expect("foo bar", 5, cut, G_N_ELEMENTS(cut));
+    tokenizer_test_expect(" foo ", 5, inner, G_N_ELEMENTS(inner));
+    tokenizer_test_expect("foo", 0, NULL, 0);
+    tokenizer_test_expect("  \n\t", 4, NULL, 0);
+}
+
+/* Words that end at, start at or run across the edge of a classified block */
+static void tokenizer_test_block_edges(void) {
+    gchar text[100];
+    const Span across[] = {{30, 5}};
+    const Span full[] = {{0, 32}, {33, 1}};
+    const Span long_word[] = {{0, 65}};
+
+    memset(text, ' ', sizeof(text));
+    memcpy(text + 30, "hello", 5);
+    tokenizer_test_expect(text, sizeof(text), across, G_N_ELEMENTS(across));
+
+    memset(text, 'x', 32);
+    text[32] = ' ';
+    text[33] = 'y';
+    tokenizer_test_expect(text, 34, full, G_N_ELEMENTS(full));
+
+    memset(text, 'z', 65);
+    tokenizer_test_expect(text, 65, long_word, G_N_ELEMENTS(long_word));
+}
+
+static void tokenizer_test_utf8(void) {
+    const Span accented[] = {{0, 6}, {7, 6}};
+    const Span no_break[] = {{0, 1}, {3, 1}};
+
+    tokenizer_test_expect("h\xc3\xa9llo w\xc3\xb6rld", 13, accented, G_N_ELEMENTS(accented));
+    tokenizer_test_expect("a\xc2\xa0" "b", 4, no_break, G_N_ELEMENTS(no_break));
+}
+
+/*
+ * Bytes on either side of the ranges in the word character sets below, the ends of the ASCII and byte ranges, and
+ * the lead and continuation bytes of multibyte characters.
+ */
+static const guchar tokenizer_test_edge_bytes[] = {0x00, 0x01, 0x09, 0x0a, 0x20, 0x23, 0x24, 0x25, 0x2c, 0x2d, 0x2e,
+                                                   0x2f, 0x30, 0x39, 0x3a, 0x40, 0x41, 0x5a, 0x5b, 0x5e, 0x5f, 0x60,
+                                                   0x61, 0x7a, 0x7b, 0x7e, 0x7f, 0x80, 0xa0, 0xbf, 0xc2, 0xc3, 0xe2,
+                                                   0xef, 0xf0, 0xf4, 0xfe, 0xff};
+
+static const gchar *tokenizer_test_sets[] = {
+    TOKENIZER_TEST_WORD_CHARS,
+    TOKENIZER_TEST_WORD_CHARS "$-",
+    "\x01\x0f\x10\x1f\x2f\x70\x7e\x7f",
+    "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a"
+    "\x1b\x1c\x1d\x1e\x1f !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`"
+    "abcdefghijklmnopqrstuvwxyz{|}~\x7f",
+};
+
+static void tokenizer_test_fill(guchar *buffer, gint length) {
+    for (gint i = 0; i < length; i++) {
+        gint kind = g_test_rand_int_range(0, 4);
+
+        if (kind < 2) {
+            buffer[i] = tokenizer_test_edge_bytes[g_test_rand_int_range(0, G_N_ELEMENTS(tokenizer_test_edge_bytes))];
+        } else if (kind == 2) {
+            buffer[i] = g_test_rand_int_range(0, 0x80);
+        } else {
+            buffer[i] = g_test_rand_int_range(0x80, 0x100);
+        }
+    }
+}
+
+static void tokenizer_test_assert_same(GArray *expected, GArray *spans) {
+    g_assert_cmpint(spans->len, ==, expected->len);
+
+    for (gint i = 0; i < expected->len; i++) {
+        g_assert_cmpint(g_array_index(spans, Span, i).position, ==, g_array_index(expected, Span, i).position);
+        g_assert_cmpint(g_array_index(spans, Span, i).length, ==, g_array_index(expected, Span, i).length);
+    }
+}
+
+/*
+ * The vector classifiers must give the spans the scalar one does over random text, at lengths that leave a partial
+ * block and from offsets that are not aligned.
+ */
+static void tokenizer_test_classifiers_agree(void) {
+    const TokenizerPath paths[] = {TOKENIZER_SSSE3, TOKENIZER_AVX2};
+    guchar buffer[300];
+    GArray *expected = g_array_new(FALSE, FALSE, sizeof(Span));
+    GArray *spans = g_array_new(FALSE, FALSE, sizeof(Span));
+    gint compared = 0;
+
+    for (gint set = 0; set < G_N_ELEMENTS(tokenizer_test_sets); set++) {
+        WordChars word_chars;
+
+        tokenizer_set_word_chars(&word_chars, tokenizer_test_sets[set]);
+
+        for (gint round = 0; round < 500; round++) {
+            gint offset = g_test_rand_int_range(0, 8);
+            gint length = g_test_rand_int_range(0, sizeof(buffer) - offset);
+            const gchar *text = (const gchar *)buffer + offset;
+
+            tokenizer_test_fill(buffer, sizeof(buffer));
+            g_array_set_size(expected, 0);
+            g_assert_true(tokenizer_scan_with(TOKENIZER_SCALAR, text, length, &word_chars, expected));
+
+            for (gint p = 0; p < G_N_ELEMENTS(paths); p++) {
+                g_array_set_size(spans, 0);
+
+                if (tokenizer_scan_with(paths[p], text, length, &word_chars, spans)) {
+                    tokenizer_test_assert_same(expected, spans);
+                    compared++;
+                }
+            }
+        }
+    }
+
+    if (compared == 0) {
+        g_test_skip("No vector classifier runs on this CPU");
+    }
+
+    g_array_free(expected, TRUE);
+    g_array_free(spans, TRUE);
+}
+
+void tokenizer_test_add(void) {
+    g_test_add_func("/core/tokenizer/range-edges", tokenizer_test_range_edges);
+    g_test_add_func("/core/tokenizer/block-edges", tokenizer_test_block_edges);
+    g_test_add_func("/core/tokenizer/utf8", tokenizer_test_utf8);
+    g_test_add_func("/core/tokenizer/classifiers-agree", tokenizer_test_classifiers_agree);
+}